@@ -0,0 +1,66 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <ostream>
+
+namespace bench {
+
+	/// Single measured value
+	struct Metric {
+		std::string name;
+		double value;
+		std::string unit;
+	};
+
+	/// Collects the results of all benchmarks, so they can be printed as one JSON object
+	class Report {
+
+		private:
+
+			std::vector<Metric> metrics;
+
+		public:
+
+			/// Add a result, names should be unique and stay the same between runs so results can be compared
+			void add(const std::string& name, double value, const std::string& unit);
+
+			/// Print all results as a JSON object
+			void print(std::ostream& out) const;
+
+	};
+
+	/// Prevent the compiler from optimizing away the computation of a value
+	template <typename T>
+	inline void keep(const T& value) {
+		asm volatile("" : : "g" (value) : "memory");
+	}
+
+	/// Run the function 'repeats' times and return the duration of the fastest run, in seconds
+	template <typename F>
+	double fastest(int repeats, F&& function) {
+		double best = std::numeric_limits<double>::max();
+
+		for (int i = 0; i < repeats; i ++) {
+			const auto start = std::chrono::steady_clock::now();
+			function();
+			const std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+
+			best = std::min(best, time.count());
+		}
+
+		return best;
+	}
+
+	/*
+	 * Benchmark groups
+	 */
+
+	void run_encoder(Report& report);
+	void run_tasml(Report& report);
+	void run_linker(Report& report);
+	void run_elf(Report& report);
+	void run_executable(Report& report);
+
+}
@@ -0,0 +1,90 @@
+#include "external.hpp"
+#include "bench.hpp"
+
+#include <out/chunk/buffer.hpp>
+#include <out/elf/buffer.hpp>
+#include <out/buffer/writer.hpp>
+
+#define CHUNK_COUNT 4096
+#define CHUNK_BYTES 1024
+
+#define ELF_SECTIONS 4
+#define ELF_SYMBOLS 4096
+#define ELF_SECTION_BYTES (4 * 1024 * 1024)
+
+#define REPEATS 5
+
+namespace bench {
+
+	using namespace asmio;
+
+	/// Measure the megabytes per second of baking a freshly built tree of chunks, with a size link for each chunk
+	static double chunk_bake() {
+
+		std::vector<uint8_t> data(CHUNK_BYTES, 0x42);
+		std::vector<ChunkBuffer::Ptr> trees;
+
+		// baking the first time caches the layout, so each run gets its own tree
+		for (int i = 0; i < REPEATS; i ++) {
+			auto root = std::make_shared<ChunkBuffer>(8);
+
+			for (int j = 0; j < CHUNK_COUNT; j ++) {
+				auto chunk = root->chunk(8);
+				chunk->link<uint32_t>([target = chunk.get()] () noexcept { return target->size(); });
+				chunk->write(data);
+			}
+
+			trees.push_back(root);
+		}
+
+		size_t bytes = 0;
+		size_t run = 0;
+
+		const double time = fastest(REPEATS, [&] () {
+			bytes = trees[run ++]->bake().size();
+		});
+
+		return bytes / time;
+	}
+
+	/// Measure the megabytes per second of serializing an ELF file with a few large sections and many symbols
+	static double elf_bytes() {
+
+		// the file can't be moved once it has symbols, they refer back to it
+		std::vector<std::unique_ptr<ElfFile>> files;
+
+		for (int i = 0; i < REPEATS; i ++) {
+			SegmentedBuffer segmented;
+			BasicBufferWriter writer {segmented};
+
+			for (int j = 0; j < ELF_SECTIONS; j ++) {
+				writer.section(BufferSegment::R | BufferSegment::X, ".text" + std::to_string(j));
+
+				for (int k = 0; k < ELF_SYMBOLS / ELF_SECTIONS; k ++) {
+					const std::string name = "s" + std::to_string(j) + "_" + std::to_string(k);
+
+					writer.export_symbol(name);
+					writer.label(name);
+					writer.put_space(ELF_SECTION_BYTES / (ELF_SYMBOLS / ELF_SECTIONS), 0xCC);
+				}
+			}
+
+			files.emplace_back(new ElfFile {to_elf(segmented, Label::UNSET)});
+		}
+
+		size_t bytes = 0;
+		size_t run = 0;
+
+		const double time = fastest(REPEATS, [&] () {
+			bytes = files[run ++]->bytes().size();
+		});
+
+		return bytes / time;
+	}
+
+	void run_elf(Report& report) {
+		report.add("elf.chunk_bake", chunk_bake() / 1e6, "MB/s");
+		report.add("elf.bytes", elf_bytes() / 1e6, "MB/s");
+	}
+
+}
@@ -0,0 +1,68 @@
+#include "external.hpp"
+#include "bench.hpp"
+
+#include <asm/x86/writer.hpp>
+#include <asm/aarch64/writer.hpp>
+
+// each block emits 8 instructions
+#define ENCODER_BLOCKS (1 << 16)
+#define ENCODER_INSTRUCTIONS (ENCODER_BLOCKS * 8)
+
+namespace bench {
+
+	using namespace asmio;
+
+	/// Measure the number of x86 instructions encoded per second, using a mix of register, immediate and memory operands
+	static double encode_x86() {
+
+		const double time = fastest(5, [] () {
+			SegmentedBuffer segmented;
+			x86::BufferWriter writer {segmented};
+
+			for (int i = 0; i < ENCODER_BLOCKS; i ++) {
+				writer.put_mov(x86::RAX, i);
+				writer.put_add(x86::RAX, x86::RCX);
+				writer.put_mov(x86::RDX, x86::ref(x86::RSI + 8));
+				writer.put_lea(x86::RAX, x86::RDI + x86::RSI * 4);
+				writer.put_cmp(x86::EAX, 42);
+				writer.put_xor(x86::R8, x86::R9);
+				writer.put_imul(x86::RAX, x86::RDX);
+				writer.put_inc(x86::ref<DWORD>(x86::RBX + x86::RCX * 2 + 16));
+			}
+
+			keep(segmented.segments().back().buffer.size());
+		});
+
+		return ENCODER_INSTRUCTIONS / time;
+	}
+
+	/// Measure the number of aarch64 instructions encoded per second, using a mix of register, immediate and memory operands
+	static double encode_aarch64() {
+
+		const double time = fastest(5, [] () {
+			SegmentedBuffer segmented;
+			arm::BufferWriter writer {segmented};
+
+			for (int i = 0; i < ENCODER_BLOCKS; i ++) {
+				writer.put_movz(arm::X0, i & 0xFFFF);
+				writer.put_add(arm::X0, arm::X0, arm::X1);
+				writer.put_ldr(arm::X2, arm::X3, 8, Sizing::UX);
+				writer.put_str(arm::X2, arm::X3, 16, Sizing::UX);
+				writer.put_sub(arm::X4, arm::X5, arm::X6);
+				writer.put_eor(arm::X7, arm::X8, arm::X9);
+				writer.put_mul(arm::X0, arm::X0, arm::X2);
+				writer.put_lsl(arm::X1, arm::X1, 3);
+			}
+
+			keep(segmented.segments().back().buffer.size());
+		});
+
+		return ENCODER_INSTRUCTIONS / time;
+	}
+
+	void run_encoder(Report& report) {
+		report.add("encoder.x86", encode_x86() / 1e6, "Minst/s");
+		report.add("encoder.aarch64", encode_aarch64() / 1e6, "Minst/s");
+	}
+
+}
@@ -0,0 +1,171 @@
+#include "external.hpp"
+#include "bench.hpp"
+
+#include <random>
+#include <out/buffer/executable.hpp>
+
+#if ARCH_X86
+#	include <asm/x86/writer.hpp>
+#else
+#	include <asm/aarch64/writer.hpp>
+#endif
+
+// each function gets its own 4K page, so every call in a random order needs a different iTLB entry
+#define DISPATCH_FUNCTIONS 8192
+#define DISPATCH_STRIDE 4096
+#define DISPATCH_CALLS (DISPATCH_FUNCTIONS * 256)
+
+#define OVERHEAD_CALLS (1 << 24)
+
+#define LATENCY_RUNS 1000
+
+namespace bench {
+
+	using namespace asmio;
+
+	/// Measure the number of calls per second into a table of functions spread over 32 MiB
+	static double dispatch(bool huge_pages) {
+
+		SegmentedBuffer segmented;
+
+#if ARCH_X86
+		x86::BufferWriter writer {segmented};
+#else
+		arm::BufferWriter writer {segmented};
+#endif
+
+		writer.section(BufferSegment::R | BufferSegment::X);
+
+		for (int i = 0; i < DISPATCH_FUNCTIONS; i ++) {
+			const size_t start = segmented.current().offset;
+
+#if ARCH_X86
+			writer.put_mov(x86::EAX, i);
+#else
+			writer.put_mov(arm::X0, i);
+#endif
+
+			writer.put_ret();
+			writer.put_space(DISPATCH_STRIDE - (segmented.current().offset - start));
+		}
+
+		ExecutableBuffer buffer = to_executable(segmented, 0, huge_pages);
+
+		std::vector<int (*)()> order;
+		order.reserve(DISPATCH_FUNCTIONS);
+
+		for (int i = 0; i < DISPATCH_FUNCTIONS; i ++) {
+			order.push_back(reinterpret_cast<int (*)()>(buffer.address() + i * DISPATCH_STRIDE));
+		}
+
+		std::shuffle(order.begin(), order.end(), std::mt19937 {42});
+
+		const double time = fastest(5, [&] () {
+			int sum = 0;
+
+			for (int i = 0; i < DISPATCH_CALLS; i ++) {
+				sum += order[i % DISPATCH_FUNCTIONS]();
+			}
+
+			keep(sum);
+		});
+
+		return DISPATCH_CALLS / time;
+	}
+
+	/// Measure the time in nanoseconds per call of a function adding two numbers, once called through scall() and once directly
+	static std::pair<double, double> call_overhead() {
+
+		SegmentedBuffer segmented;
+
+#if ARCH_X86
+		x86::BufferWriter writer {segmented};
+
+		// scall() passes a pointer to the packed arguments
+		writer.label("packed");
+		writer.put_mov(x86::RAX, x86::ref(x86::RDI));
+		writer.put_add(x86::RAX, x86::ref(x86::RDI + 8));
+		writer.put_ret();
+
+		writer.label("native");
+		writer.put_lea(x86::RAX, x86::RDI + x86::RSI);
+		writer.put_ret();
+#else
+		arm::BufferWriter writer {segmented};
+
+		// scall() passes a pointer to the packed arguments
+		writer.label("packed");
+		writer.put_ldr(arm::X1, arm::X0, 0, Sizing::UX);
+		writer.put_ldr(arm::X2, arm::X0, 8, Sizing::UX);
+		writer.put_add(arm::X0, arm::X1, arm::X2);
+		writer.put_ret();
+
+		writer.label("native");
+		writer.put_add(arm::X0, arm::X0, arm::X1);
+		writer.put_ret();
+#endif
+
+		ExecutableBuffer buffer = to_executable(segmented);
+		auto native = buffer.function<int64_t(int64_t, int64_t)>("native");
+		const size_t packed = buffer.address("packed") - buffer.address();
+
+		const double packed_time = fastest(5, [&] () {
+			int64_t sum = 0;
+
+			for (int64_t i = 0; i < OVERHEAD_CALLS; i ++) {
+				sum = buffer.scall<int64_t>(packed, sum, i);
+			}
+
+			keep(sum);
+		});
+
+		const double native_time = fastest(5, [&] () {
+			int64_t sum = 0;
+
+			for (int64_t i = 0; i < OVERHEAD_CALLS; i ++) {
+				sum = native(sum, i);
+			}
+
+			keep(sum);
+		});
+
+		return {packed_time * 1e9 / OVERHEAD_CALLS, native_time * 1e9 / OVERHEAD_CALLS};
+	}
+
+	/// Measure the time in microseconds from writing a small function to calling it, including linking and mapping
+	static double to_executable_latency() {
+
+		const double time = fastest(5, [] () {
+			for (int i = 0; i < LATENCY_RUNS; i ++) {
+				SegmentedBuffer segmented;
+
+#if ARCH_X86
+				x86::BufferWriter writer {segmented};
+				writer.put_lea(x86::RAX, x86::RDI + x86::RSI);
+				writer.put_ret();
+#else
+				arm::BufferWriter writer {segmented};
+				writer.put_add(arm::X0, arm::X0, arm::X1);
+				writer.put_ret();
+#endif
+
+				ExecutableBuffer buffer = to_executable(segmented);
+				keep(buffer.function<int64_t(int64_t, int64_t)>()(i, 1));
+			}
+		});
+
+		return time * 1e6 / LATENCY_RUNS;
+	}
+
+	void run_executable(Report& report) {
+		report.add("executable.to_executable", to_executable_latency(), "us");
+
+		const auto [packed, native] = call_overhead();
+		report.add("executable.call_scall", packed, "ns");
+		report.add("executable.call_function", native, "ns");
+
+		report.add("executable.dispatch", dispatch(false) / 1e6, "Mcalls/s");
+		report.add("executable.dispatch_huge_pages", dispatch(true) / 1e6, "Mcalls/s");
+	}
+
+}
@@ -0,0 +1,60 @@
+#include "external.hpp"
+#include "bench.hpp"
+
+#include <asm/x86/writer.hpp>
+#include <out/elf/buffer.hpp>
+
+#define LINKER_FUNCTIONS 4096
+#define LINKER_CALLS 64
+
+namespace bench {
+
+	using namespace asmio;
+
+	/// Measure the number of fixups applied per second, each function calls some others that are spread over the whole buffer,
+	/// the code is only linked, never executed, so x86 is used on all hosts
+	static double link(size_t workers) {
+
+		SegmentedBuffer segmented;
+		segmented.set_link_workers(workers);
+		x86::BufferWriter writer {segmented};
+
+		std::vector<Label> labels;
+		labels.reserve(LINKER_FUNCTIONS);
+
+		for (int i = 0; i < LINKER_FUNCTIONS; i ++) {
+			labels.emplace_back("f" + std::to_string(i));
+		}
+
+		writer.section(BufferSegment::R | BufferSegment::X);
+
+		for (int i = 0; i < LINKER_FUNCTIONS; i ++) {
+			writer.label(labels[i]);
+
+			for (int j = 0; j < LINKER_CALLS; j ++) {
+				writer.put_call(labels[(i * 7919 + j * 104729) % LINKER_FUNCTIONS]);
+			}
+
+			writer.put_ret();
+		}
+
+		segmented.align(getpagesize());
+
+		// linking only overwrites the fixups, so it can be repeated
+		const double time = fastest(5, [&] () {
+			segmented.link(DEFAULT_ELF_MOUNT);
+		});
+
+		return LINKER_FUNCTIONS * LINKER_CALLS / time;
+	}
+
+	void run_linker(Report& report) {
+		report.add("linker.link", link(1) / 1e6, "Mfixups/s");
+
+		// scaling with the number of link workers
+		for (size_t workers : {2, 4, 8}) {
+			report.add("linker.link_" + std::to_string(workers), link(workers) / 1e6, "Mfixups/s");
+		}
+	}
+
+}
@@ -0,0 +1,51 @@
+#include "external.hpp"
+#include "bench.hpp"
+
+namespace bench {
+
+	/*
+	 * class Report
+	 */
+
+	void Report::add(const std::string& name, double value, const std::string& unit) {
+		metrics.emplace_back(name, value, unit);
+	}
+
+	void Report::print(std::ostream& out) const {
+		out << "{\n";
+
+		for (size_t i = 0; i < metrics.size(); i ++) {
+			const Metric& metric = metrics[i];
+
+			out << "\t\"" << metric.name << "\": {\"value\": " << std::fixed << std::setprecision(3) << metric.value << ", \"unit\": \"" << metric.unit << "\"}";
+			out << (i + 1 < metrics.size() ? ",\n" : "\n");
+		}
+
+		out << "}\n";
+	}
+
+}
+
+/// Run all benchmark groups, or only the ones named in the arguments, and print the results as JSON
+int main(int argc, const char** argv) {
+
+	const std::vector<std::pair<std::string, void (*) (bench::Report&)>> groups {
+		{"encoder", bench::run_encoder},
+		{"tasml", bench::run_tasml},
+		{"linker", bench::run_linker},
+		{"elf", bench::run_elf},
+		{"executable", bench::run_executable},
+	};
+
+	const std::vector<std::string> selected {argv + 1, argv + argc};
+	bench::Report report;
+
+	for (const auto& [name, run] : groups) {
+		if (selected.empty() || std::find(selected.begin(), selected.end(), name) != selected.end()) {
+			run(report);
+		}
+	}
+
+	report.print(std::cout);
+
+}
@@ -0,0 +1,173 @@
+#include "external.hpp"
+#include "bench.hpp"
+
+#include <random>
+#include <fstream>
+#include <sys/wait.h>
+#include <sys/resource.h>
+#include <tasml/tokenizer.hpp>
+#include <tasml/top.hpp>
+#include <util/mapped.hpp>
+#include <util/tmp.hpp>
+
+#define TOKENIZER_LINES 100000
+#define ASSEMBLER_STATEMENTS 1000000
+
+namespace bench {
+
+	using namespace asmio;
+
+	/// Measure the number of source megabytes tokenized per second
+	static double tokenize() {
+
+		std::string code = "lang x86\nsection rx\n";
+
+		for (int i = 0; i < TOKENIZER_LINES; i ++) {
+			const std::string id = std::to_string(i);
+			code += "l" + id + ": mov rcx, 0x" + id + " ; jne @l" + id + " /* inline */\n";
+			code += "add rax, [rbx + rcx * 4] ; dec rax // " + id + "\n";
+		}
+
+		const double time = fastest(5, [&] () {
+			tasml::ErrorHandler reporter {"bench", false};
+			keep(tasml::tokenize(reporter, code).size());
+		});
+
+		return code.size() / time;
+	}
+
+	/// Wall time and the peak resident memory of a run
+	struct Usage {
+		double time;
+		double memory;
+	};
+
+	/// Generate x86 source of the given number of statements, drawn at random from many mnemonics to exercise the dispatch
+	static std::string random_source(int count) {
+
+		const std::vector<std::string> statements {
+			"mov rax, rbx", "add rax, 1", "sub rcx, rdx", "xor eax, eax", "and rax, rcx",
+			"or rdx, 8", "cmp rax, rbx", "test rax, rax", "inc rcx", "dec rdx",
+			"push rbx", "pop rbx", "mov rax, [rbx + rcx * 4]", "imul rax, rcx", "shl rax, 2",
+			"shr rdx, 1", "sar rcx, 3", "neg rax", "not rbx", "nop",
+			"ret", "xchg rax, rbx", "bswap eax", "movzx eax, cl", "adc rax, rdx",
+		};
+
+		std::string code = "lang x86\n";
+		std::mt19937 random {42};
+
+		for (int i = 0; i < count; i ++) {
+			code += statements[random() % statements.size()] + "\n";
+		}
+
+		return code;
+	}
+
+	/// Assemble the source and throw if it contained errors
+	template <typename T>
+	static void assemble_checked(T&& source) {
+		tasml::ErrorHandler reporter {"bench", false};
+		keep(tasml::assemble(reporter, source).count());
+
+		if (!reporter.ok()) {
+			throw std::runtime_error {"Assembly of the benchmark source failed"};
+		}
+	}
+
+	/// Run the function in a child process, so that its peak resident memory can be measured on its own
+	template <typename F>
+	static Usage isolated(F&& function) {
+		const auto start = std::chrono::steady_clock::now();
+		const pid_t pid = fork();
+
+		if (pid == 0) {
+			try {
+				function();
+			} catch (...) {
+				_exit(1);
+			}
+
+			_exit(0);
+		}
+
+		int status = 0;
+		rusage usage {};
+
+		if (pid < 0 || wait4(pid, &status, 0, &usage) != pid || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+			throw std::runtime_error {"Benchmark child process failed"};
+		}
+
+		const std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+		return {time.count(), usage.ru_maxrss * 1024.0};
+	}
+
+	/// Measure the number of statements assembled per second
+	static double assemble() {
+
+		const std::string code = random_source(ASSEMBLER_STATEMENTS);
+
+		const double time = fastest(3, [&] () {
+			assemble_checked(code);
+		});
+
+		return ASSEMBLER_STATEMENTS / time;
+	}
+
+	/// Measure the wall time and the memory added on top of an idle process, when assembling a file that was
+	/// read into a string, a memory mapped file, and a file streamed through the std::istream overload
+	static std::array<Usage, 3> input_paths() {
+
+		util::TempFile file {".asm"};
+		file.write(random_source(ASSEMBLER_STATEMENTS));
+
+		const std::string path = file.path();
+		const Usage idle = isolated([] () {});
+
+		const std::array<std::function<void()>, 3> paths {
+			[&] () {
+				std::string code;
+				std::ifstream input {path};
+				util::load_file_into(input, code);
+				assemble_checked(code);
+			},
+			[&] () {
+				util::MappedFile mapped {path};
+				assemble_checked(mapped.view());
+			},
+			[&] () {
+				std::ifstream input {path};
+				assemble_checked(input);
+			},
+		};
+
+		std::array<Usage, 3> results;
+
+		for (size_t i = 0; i < paths.size(); i ++) {
+			Usage best {std::numeric_limits<double>::max(), std::numeric_limits<double>::max()};
+
+			for (int repeat = 0; repeat < 3; repeat ++) {
+				const Usage usage = isolated(paths[i]);
+				best.time = std::min(best.time, usage.time);
+				best.memory = std::min(best.memory, usage.memory - idle.memory);
+			}
+
+			results[i] = best;
+		}
+
+		return results;
+	}
+
+	void run_tasml(Report& report) {
+		report.add("tasml.tokenize", tokenize() / 1e6, "MB/s");
+		report.add("tasml.assemble", assemble() / 1e6, "Mstmt/s");
+
+		const auto [string, mapped, streamed] = input_paths();
+		report.add("tasml.input_string.time", string.time, "s");
+		report.add("tasml.input_string.rss", string.memory / 1e6, "MB");
+		report.add("tasml.input_mapped.time", mapped.time, "s");
+		report.add("tasml.input_mapped.rss", mapped.memory / 1e6, "MB");
+		report.add("tasml.input_stream.time", streamed.time, "s");
+		report.add("tasml.input_stream.rss", streamed.memory / 1e6, "MB");
+	}
+
+}
@@ -3,6 +3,7 @@
 #include "external.hpp"
 #include "../../util.hpp"
 #include "out/buffer/sizes.hpp"
+#include "util/lookup.hpp"
 
 namespace asmio::arm {
 
@@ -122,4 +123,75 @@ namespace asmio::arm {
 	constexpr Registry W29 = W(29);
 	constexpr Registry W30 = W(30);
 
+	/// Register names accepted by the assembler, lookup is case-insensitive
+	constexpr auto REGISTRY_NAMES = util::name_table<Registry>({
+		{"wzr", WZR},
+		{"xzr", XZR},
+		{"sp", SP},
+		{"lr", LR},
+		{"fp", FP},
+		{"x0", X0},
+		{"x1", X1},
+		{"x2", X2},
+		{"x3", X3},
+		{"x4", X4},
+		{"x5", X5},
+		{"x6", X6},
+		{"x7", X7},
+		{"x8", X8},
+		{"x9", X9},
+		{"x10", X10},
+		{"x11", X11},
+		{"x12", X12},
+		{"x13", X13},
+		{"x14", X14},
+		{"x15", X15},
+		{"x16", X16},
+		{"x17", X17},
+		{"x18", X18},
+		{"x19", X19},
+		{"x20", X20},
+		{"x21", X21},
+		{"x22", X22},
+		{"x23", X23},
+		{"x24", X24},
+		{"x25", X25},
+		{"x26", X26},
+		{"x27", X27},
+		{"x28", X28},
+		{"x29", X29},
+		{"x30", X30},
+		{"w0", W0},
+		{"w1", W1},
+		{"w2", W2},
+		{"w3", W3},
+		{"w4", W4},
+		{"w5", W5},
+		{"w6", W6},
+		{"w7", W7},
+		{"w8", W8},
+		{"w9", W9},
+		{"w10", W10},
+		{"w11", W11},
+		{"w12", W12},
+		{"w13", W13},
+		{"w14", W14},
+		{"w15", W15},
+		{"w16", W16},
+		{"w17", W17},
+		{"w18", W18},
+		{"w19", W19},
+		{"w20", W20},
+		{"w21", W21},
+		{"w22", W22},
+		{"w23", W23},
+		{"w24", W24},
+		{"w25", W25},
+		{"w26", W26},
+		{"w27", W27},
+		{"w28", W28},
+		{"w29", W29},
+		{"w30", W30}
+	});
+
 }
\ No newline at end of file
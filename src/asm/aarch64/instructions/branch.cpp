@@ -8,17 +8,17 @@ namespace asmio::arm {
 	 */
 
 	void BufferWriter::put_b(const Label& label) {
-		buffer.add_linkage(label, 0, link_26_0_aligned);
+		buffer.add_linkage(label, 0, Linkage::ALIGNED, 26, 0, 0);
 		put_dword(0b000101 << 26);
 	}
 
 	void BufferWriter::put_b(Condition condition, const Label& label) {
-		buffer.add_linkage(label, 0, link_19_5_aligned);
+		buffer.add_linkage(label, 0, Linkage::ALIGNED, 19, 0, 5);
 		put_dword(0b01010100 << 24 | uint8_t(condition));
 	}
 
 	void BufferWriter::put_bl(const Label& label) {
-		buffer.add_linkage(label, 0, link_26_0_aligned);
+		buffer.add_linkage(label, 0, Linkage::ALIGNED, 26, 0, 0);
 		put_dword(0b100101 << 26);
 	}
 
@@ -34,13 +34,13 @@ namespace asmio::arm {
 
 	void BufferWriter::put_cbnz(Registry src, const Label& label) {
 		uint16_t sf = src.wide() ? 1 : 0;
-		buffer.add_linkage(label, 0, link_19_5_aligned);
+		buffer.add_linkage(label, 0, Linkage::ALIGNED, 19, 0, 5);
 		put_dword(sf << 31 | 0b011010'1 << 24 | src.reg);
 	}
 
 	void BufferWriter::put_cbz(Registry src, const Label& label) {
 		uint16_t sf = src.wide() ? 1 : 0;
-		buffer.add_linkage(label, 0, link_19_5_aligned);
+		buffer.add_linkage(label, 0, Linkage::ALIGNED, 19, 0, 5);
 		put_dword(sf << 31 | 0b011010'0 << 24 | src.reg);
 	}
 
@@ -51,7 +51,7 @@ namespace asmio::arm {
 			throw std::runtime_error {"Invalid operands, expected qword register in this context"};
 		}
 
-		buffer.add_linkage(label, 0, link_14_5_aligned);
+		buffer.add_linkage(label, 0, Linkage::ALIGNED, 14, 0, 5);
 		put_dword(sf << 31 | 0b011011'0 << 24 | (0b11111 & bit6) << 19 | test.reg);
 	}
 
@@ -62,7 +62,7 @@ namespace asmio::arm {
 			throw std::runtime_error {"Invalid operands, expected qword register in this context"};
 		}
 
-		buffer.add_linkage(label, 0, link_14_5_aligned);
+		buffer.add_linkage(label, 0, Linkage::ALIGNED, 14, 0, 5);
 		put_dword(sf << 31 | 0b011011'1 << 24 | (0b11111 & bit6) << 19 | test.reg);
 	}
 
@@ -18,31 +18,16 @@ namespace asmio::arm {
 	template <>
 	Registry parse_argument(TokenStream stream) {
 		const Token& token = stream.expect(Token::NAME);
-		std::string raw = util::to_lower(token.raw);
-
-		if (raw == "wzr") return WZR;
-		if (raw == "xzr") return XZR;
-		if (raw == "lr") return LR;
-		if (raw == "sp") return SP;
-		if (raw == "fp") return FP;
-
-		if (raw[0] == 'x') {
-			int index = util::parse_decimal(raw.substr(1));
-
-			if (index >= 0 && index <= 30) {
-				return X(index);
-			}
 
-			throw std::runtime_error {"Invalid register number, expected value in range [0, 30]"};
+		if (const Registry* registry = REGISTRY_NAMES.find(token.raw)) {
+			return *registry;
 		}
 
-		if (raw[0] == 'w') {
-			int index = util::parse_decimal(raw.substr(1));
-
-			if (index >= 0 && index <= 30) {
-				return W(index);
-			}
+		// give a more helpful message for out of range general purpose registers
+		const std::string_view raw = token.raw;
+		const bool numbered = raw.size() > 1 && std::all_of(raw.begin() + 1, raw.end(), [] (char chr) { return chr >= '0' && chr <= '9'; });
 
+		if (numbered && (raw[0] == 'x' || raw[0] == 'X' || raw[0] == 'w' || raw[0] == 'W')) {
 			throw std::runtime_error {"Invalid register number, expected value in range [0, 30]"};
 		}
 
@@ -52,7 +37,7 @@ namespace asmio::arm {
 	template <>
 	Label parse_argument(TokenStream stream) {
 		const Token& label = stream.expect(Token::REFERENCE);
-		return {label.raw.c_str() + 1};
+		return label.as_label();
 	}
 
 	template <>
@@ -149,4 +134,8 @@ namespace asmio::arm {
 		return ElfMachine::AARCH64;
 	}
 
+	Padding::Filler LanguageModule::filler() const {
+		return BufferWriter::put_nops;
+	}
+
 }
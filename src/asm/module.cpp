@@ -76,7 +76,7 @@ namespace asmio {
 
 	void Module::parse(ErrorHandler& reporter, TokenStream stream, SegmentedBuffer& buffer) const {
 
-		BasicBufferWriter writer {buffer};
+		BasicBufferWriter writer {buffer, filler()};
 
 		/*
 		 * Label Definitions
@@ -145,6 +145,18 @@ namespace asmio {
 
 		}
 
+		/*
+		 * Alignment
+		 */
+
+		if (stream.accept("align")) {
+			const int64_t alignment = stream.expect(Token::INT).as_int();
+			stream.terminal();
+
+			writer.align(alignment);
+			return;
+		}
+
 		/*
 		 * Data statements
 		 */
@@ -172,4 +184,8 @@ namespace asmio {
 		return ElfMachine::NONE;
 	}
 
+	Padding::Filler Module::filler() const {
+		return nullptr;
+	}
+
 }
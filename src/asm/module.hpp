@@ -2,6 +2,7 @@
 #include <memory>
 #include <unordered_map>
 #include <out/elf/header.hpp>
+#include <out/buffer/segmented.hpp>
 
 #include "util.hpp"
 
@@ -19,8 +20,6 @@ namespace tasml {
 
 namespace asmio {
 
-	class SegmentedBuffer;
-
 	/// Struct describing capabilities of a particular module
 	struct FeatureSet {};
 
@@ -59,6 +58,13 @@ namespace asmio {
 		 */
 		virtual ElfMachine machine() const;
 
+		/**
+		 * Obtain the function used by the 'align' directive to fill the gap before
+		 * the aligned position, this should write no-op instructions of the architecture,
+		 * if it returns nullptr the gap is filled with zeros.
+		 */
+		virtual Padding::Filler filler() const;
+
 	};
 
 	/// module registry, to add a new language to the registry use REGISTER_MODULE(ModuleName);
@@ -9,6 +9,13 @@
 
 namespace asmio::x86 {
 
+	/// AVX-512 operand decorators, see mask(), maskz() and broadcast()
+	struct Decorator {
+		uint8_t mask : 3 = 0;       // number of the opmask register, K0 means no masking
+		bool zeroing : 1 = false;   // clear the masked out elements instead of leaving them unchanged
+		bool broadcast : 1 = false; // memory operand is a single element repeated across the whole vector
+	};
+
 	/// Used to represent any valid x86 instruction argument
 	class Location {
 
@@ -21,6 +28,7 @@ namespace asmio::x86 {
 			const uint8_t size;
 			const int64_t offset;
 			const Label label;
+			const Decorator decorator;
 
 			constexpr void check_non_referential(const char* why) const {
 				if (reference) throw std::runtime_error {why};
@@ -41,8 +49,8 @@ namespace asmio::x86 {
 			Location(ScaledRegistry index)
 			: Location(UNSET, index.registry, index.scale, 0, nullptr, index.registry.size, false) {}
 
-			explicit Location(Registry base, Registry index, uint32_t scale, int64_t offset, const Label& label, int size, bool reference)
-			: base(base), index(index), scale(scale), reference(reference), size(size), offset(offset), label(label) {
+			explicit Location(Registry base, Registry index, uint32_t scale, int64_t offset, const Label& label, int size, bool reference, Decorator decorator = {})
+			: base(base), index(index), scale(scale), reference(reference), size(size), offset(offset), label(label), decorator(decorator) {
 				check_valid_scale(index, scale);
 			}
 
@@ -50,17 +58,38 @@ namespace asmio::x86 {
 
 			Location ref() const {
 				check_non_referential("Can't reference a reference!");
-				return Location {base, index, scale, offset, label, VOID, true};
+				return Location {base, index, scale, offset, label, VOID, true, decorator};
 			}
 
 			Location cast(uint8_t bytes) const {
 				if (reference || is_immediate()) {
-					return Location {base, index, scale, offset, label, bytes, reference};
+					return Location {base, index, scale, offset, label, bytes, reference, decorator};
 				}
 
 				throw std::runtime_error {"The result of this expression is of fixed size!"};
 			}
 
+			Location masked(Registry opmask, bool zeroing) const {
+				if (!opmask.is(Registry::MASK)) {
+					throw std::runtime_error {"Invalid operand, expected an opmask register!"};
+				}
+
+				// K0 in the 'aaa' field means 'no masking'
+				if (opmask.reg == 0) {
+					throw std::runtime_error {"Invalid operand, K0 can't be used as a write mask!"};
+				}
+
+				return Location {base, index, scale, offset, label, size, reference, {opmask.reg, zeroing, decorator.broadcast}};
+			}
+
+			Location broadcasted() const {
+				if (!reference) {
+					throw std::runtime_error {"Only a memory reference can be broadcast!"};
+				}
+
+				return Location {base, index, scale, offset, label, size, reference, {decorator.mask, decorator.zeroing, true}};
+			}
+
 			Location operator + (int64_t extend) const {
 				check_non_referential("Can't modify a reference!");
 				return Location {base, index, scale, offset + extend, label, size, false};
@@ -91,11 +120,36 @@ namespace asmio::x86 {
 				return index.is(Registry::GENERAL);
 			}
 
+			/// Checks if this location uses a vector register as the index component (VSIB), used by the gather instructions
+			constexpr bool is_vector_indexed() const {
+				return index.is(Registry::VECTOR);
+			}
+
 			/// Checks if this location is a simple un-referenced register
 			constexpr bool is_simple() const {
 				return base.is(Registry::GENERAL) && !is_indexed() && offset == 0 && !reference && !is_labeled();
 			}
 
+			/// Checks if this location is a simple un-referenced SSE or AVX register
+			constexpr bool is_vector() const {
+				return base.is(Registry::VECTOR) && !is_indexed() && offset == 0 && !reference && !is_labeled();
+			}
+
+			/// Checks if this location is a simple un-referenced AVX-512 opmask register
+			constexpr bool is_opmask() const {
+				return base.is(Registry::MASK) && !is_indexed() && offset == 0 && !reference && !is_labeled();
+			}
+
+			/// Checks if this location has an AVX-512 opmask applied to it
+			constexpr bool is_masked() const {
+				return decorator.mask != 0;
+			}
+
+			/// Checks if this location is an AVX-512 embedded broadcast
+			constexpr bool is_broadcast() const {
+				return decorator.broadcast;
+			}
+
 			/// Checks if this location is a simple un-referenced accumulator, used when encoding short-forms
 			constexpr bool is_accum() const {
 				return base.is(Registry::ACCUMULATOR) && is_simple();
@@ -141,10 +195,16 @@ namespace asmio::x86 {
 				return is_labeled() && base == UNSET && index == UNSET && !reference;
 			}
 
-			constexpr uint8_t get_mod_flag() const {
+			/// The EVEX instructions scale the 8 bit displacement by the size of the memory operand (disp8*N),
+			/// an offset that is not a multiple of that size needs to be encoded as a 32 bit displacement
+			constexpr uint8_t get_mod_flag(uint8_t disp_scale = 1) const {
 				if (!label.empty()) return MOD_QUAD;
 				if (offset == 0) return MOD_NONE;
-				if (util::min_bytes(offset) == BYTE) return MOD_BYTE;
+				if (offset % disp_scale != 0) return MOD_QUAD;
+
+				// the 8 bit displacement is sign extended
+				const int64_t disp = offset / disp_scale;
+				if (disp >= INT8_MIN && disp <= INT8_MAX) return MOD_BYTE;
 				return MOD_QUAD;
 			}
 
@@ -215,6 +275,22 @@ namespace asmio::x86 {
 		return location.ref().cast(size_hint);
 	}
 
+	/// Apply AVX-512 merge masking, the elements not selected by the opmask keep their previous value
+	inline Location mask(Location location, Registry opmask) {
+		return location.masked(opmask, false);
+	}
+
+	/// Apply AVX-512 zero masking, the elements not selected by the opmask are cleared
+	inline Location maskz(Location location, Registry opmask) {
+		return location.masked(opmask, true);
+	}
+
+	/// Reference a single element in memory and broadcast it to all elements of the AVX-512 vector operand
+	template<uint8_t size_hint = VOID>
+	Location broadcast(Location location) {
+		return ref<size_hint>(location).broadcasted();
+	}
+
 	/// Deduce the operand size from a operand pair, also perform limited error checking
 	uint8_t pair_size(const Location& lhs, const Location& rhs);
 
@@ -5,6 +5,7 @@
 #include "out/buffer/sizes.hpp"
 #include "asm/util.hpp"
 #include <macro.hpp>
+#include <util/lookup.hpp>
 
 namespace asmio::x86 {
 
@@ -48,6 +49,8 @@ namespace asmio::x86 {
 			ACCUMULATOR = 0b0000100, // this is the accumulator (RAX/EAX/AX)
 			REX         = 0b0001000, // this registers requires the REX prefix to be encoded
 			HIGH_BYTE   = 0b0010000, // registers that CANT be used with REX prefix present
+			VECTOR      = 0b0100000, // SSE, AVX and AVX-512 registers (XMM, YMM, ZMM)
+			MASK        = 0b1000000, // AVX-512 opmask registers (K0-7)
 		};
 
 		const uint8_t size; // size in bytes
@@ -179,4 +182,303 @@ namespace asmio::x86 {
 	constexpr Registry R15D  {DWORD, 0b1111, Registry::GENERAL | Registry::REX};
 	constexpr Registry R15   {QWORD, 0b1111, Registry::GENERAL | Registry::REX};
 
+	/*
+	 * SSE
+	 */
+
+	constexpr Registry XMM0  {XWORD, 0b0000, Registry::VECTOR};
+	constexpr Registry XMM1  {XWORD, 0b0001, Registry::VECTOR};
+	constexpr Registry XMM2  {XWORD, 0b0010, Registry::VECTOR};
+	constexpr Registry XMM3  {XWORD, 0b0011, Registry::VECTOR};
+	constexpr Registry XMM4  {XWORD, 0b0100, Registry::VECTOR};
+	constexpr Registry XMM5  {XWORD, 0b0101, Registry::VECTOR};
+	constexpr Registry XMM6  {XWORD, 0b0110, Registry::VECTOR};
+	constexpr Registry XMM7  {XWORD, 0b0111, Registry::VECTOR};
+	constexpr Registry XMM8  {XWORD, 0b1000, Registry::VECTOR | Registry::REX};
+	constexpr Registry XMM9  {XWORD, 0b1001, Registry::VECTOR | Registry::REX};
+	constexpr Registry XMM10 {XWORD, 0b1010, Registry::VECTOR | Registry::REX};
+	constexpr Registry XMM11 {XWORD, 0b1011, Registry::VECTOR | Registry::REX};
+	constexpr Registry XMM12 {XWORD, 0b1100, Registry::VECTOR | Registry::REX};
+	constexpr Registry XMM13 {XWORD, 0b1101, Registry::VECTOR | Registry::REX};
+	constexpr Registry XMM14 {XWORD, 0b1110, Registry::VECTOR | Registry::REX};
+	constexpr Registry XMM15 {XWORD, 0b1111, Registry::VECTOR | Registry::REX};
+
+	/*
+	 * AVX
+	 */
+
+	constexpr Registry YMM0  {YWORD, 0b0000, Registry::VECTOR};
+	constexpr Registry YMM1  {YWORD, 0b0001, Registry::VECTOR};
+	constexpr Registry YMM2  {YWORD, 0b0010, Registry::VECTOR};
+	constexpr Registry YMM3  {YWORD, 0b0011, Registry::VECTOR};
+	constexpr Registry YMM4  {YWORD, 0b0100, Registry::VECTOR};
+	constexpr Registry YMM5  {YWORD, 0b0101, Registry::VECTOR};
+	constexpr Registry YMM6  {YWORD, 0b0110, Registry::VECTOR};
+	constexpr Registry YMM7  {YWORD, 0b0111, Registry::VECTOR};
+	constexpr Registry YMM8  {YWORD, 0b1000, Registry::VECTOR | Registry::REX};
+	constexpr Registry YMM9  {YWORD, 0b1001, Registry::VECTOR | Registry::REX};
+	constexpr Registry YMM10 {YWORD, 0b1010, Registry::VECTOR | Registry::REX};
+	constexpr Registry YMM11 {YWORD, 0b1011, Registry::VECTOR | Registry::REX};
+	constexpr Registry YMM12 {YWORD, 0b1100, Registry::VECTOR | Registry::REX};
+	constexpr Registry YMM13 {YWORD, 0b1101, Registry::VECTOR | Registry::REX};
+	constexpr Registry YMM14 {YWORD, 0b1110, Registry::VECTOR | Registry::REX};
+	constexpr Registry YMM15 {YWORD, 0b1111, Registry::VECTOR | Registry::REX};
+
+	/*
+	 * AVX-512, registers 16-31 can only be encoded with the EVEX prefix
+	 */
+
+	constexpr Registry XMM16 {XWORD, 0b10000, Registry::VECTOR};
+	constexpr Registry XMM17 {XWORD, 0b10001, Registry::VECTOR};
+	constexpr Registry XMM18 {XWORD, 0b10010, Registry::VECTOR};
+	constexpr Registry XMM19 {XWORD, 0b10011, Registry::VECTOR};
+	constexpr Registry XMM20 {XWORD, 0b10100, Registry::VECTOR};
+	constexpr Registry XMM21 {XWORD, 0b10101, Registry::VECTOR};
+	constexpr Registry XMM22 {XWORD, 0b10110, Registry::VECTOR};
+	constexpr Registry XMM23 {XWORD, 0b10111, Registry::VECTOR};
+	constexpr Registry XMM24 {XWORD, 0b11000, Registry::VECTOR | Registry::REX};
+	constexpr Registry XMM25 {XWORD, 0b11001, Registry::VECTOR | Registry::REX};
+	constexpr Registry XMM26 {XWORD, 0b11010, Registry::VECTOR | Registry::REX};
+	constexpr Registry XMM27 {XWORD, 0b11011, Registry::VECTOR | Registry::REX};
+	constexpr Registry XMM28 {XWORD, 0b11100, Registry::VECTOR | Registry::REX};
+	constexpr Registry XMM29 {XWORD, 0b11101, Registry::VECTOR | Registry::REX};
+	constexpr Registry XMM30 {XWORD, 0b11110, Registry::VECTOR | Registry::REX};
+	constexpr Registry XMM31 {XWORD, 0b11111, Registry::VECTOR | Registry::REX};
+
+	constexpr Registry YMM16 {YWORD, 0b10000, Registry::VECTOR};
+	constexpr Registry YMM17 {YWORD, 0b10001, Registry::VECTOR};
+	constexpr Registry YMM18 {YWORD, 0b10010, Registry::VECTOR};
+	constexpr Registry YMM19 {YWORD, 0b10011, Registry::VECTOR};
+	constexpr Registry YMM20 {YWORD, 0b10100, Registry::VECTOR};
+	constexpr Registry YMM21 {YWORD, 0b10101, Registry::VECTOR};
+	constexpr Registry YMM22 {YWORD, 0b10110, Registry::VECTOR};
+	constexpr Registry YMM23 {YWORD, 0b10111, Registry::VECTOR};
+	constexpr Registry YMM24 {YWORD, 0b11000, Registry::VECTOR | Registry::REX};
+	constexpr Registry YMM25 {YWORD, 0b11001, Registry::VECTOR | Registry::REX};
+	constexpr Registry YMM26 {YWORD, 0b11010, Registry::VECTOR | Registry::REX};
+	constexpr Registry YMM27 {YWORD, 0b11011, Registry::VECTOR | Registry::REX};
+	constexpr Registry YMM28 {YWORD, 0b11100, Registry::VECTOR | Registry::REX};
+	constexpr Registry YMM29 {YWORD, 0b11101, Registry::VECTOR | Registry::REX};
+	constexpr Registry YMM30 {YWORD, 0b11110, Registry::VECTOR | Registry::REX};
+	constexpr Registry YMM31 {YWORD, 0b11111, Registry::VECTOR | Registry::REX};
+
+	constexpr Registry ZMM0  {ZWORD, 0b00000, Registry::VECTOR};
+	constexpr Registry ZMM1  {ZWORD, 0b00001, Registry::VECTOR};
+	constexpr Registry ZMM2  {ZWORD, 0b00010, Registry::VECTOR};
+	constexpr Registry ZMM3  {ZWORD, 0b00011, Registry::VECTOR};
+	constexpr Registry ZMM4  {ZWORD, 0b00100, Registry::VECTOR};
+	constexpr Registry ZMM5  {ZWORD, 0b00101, Registry::VECTOR};
+	constexpr Registry ZMM6  {ZWORD, 0b00110, Registry::VECTOR};
+	constexpr Registry ZMM7  {ZWORD, 0b00111, Registry::VECTOR};
+	constexpr Registry ZMM8  {ZWORD, 0b01000, Registry::VECTOR | Registry::REX};
+	constexpr Registry ZMM9  {ZWORD, 0b01001, Registry::VECTOR | Registry::REX};
+	constexpr Registry ZMM10 {ZWORD, 0b01010, Registry::VECTOR | Registry::REX};
+	constexpr Registry ZMM11 {ZWORD, 0b01011, Registry::VECTOR | Registry::REX};
+	constexpr Registry ZMM12 {ZWORD, 0b01100, Registry::VECTOR | Registry::REX};
+	constexpr Registry ZMM13 {ZWORD, 0b01101, Registry::VECTOR | Registry::REX};
+	constexpr Registry ZMM14 {ZWORD, 0b01110, Registry::VECTOR | Registry::REX};
+	constexpr Registry ZMM15 {ZWORD, 0b01111, Registry::VECTOR | Registry::REX};
+	constexpr Registry ZMM16 {ZWORD, 0b10000, Registry::VECTOR};
+	constexpr Registry ZMM17 {ZWORD, 0b10001, Registry::VECTOR};
+	constexpr Registry ZMM18 {ZWORD, 0b10010, Registry::VECTOR};
+	constexpr Registry ZMM19 {ZWORD, 0b10011, Registry::VECTOR};
+	constexpr Registry ZMM20 {ZWORD, 0b10100, Registry::VECTOR};
+	constexpr Registry ZMM21 {ZWORD, 0b10101, Registry::VECTOR};
+	constexpr Registry ZMM22 {ZWORD, 0b10110, Registry::VECTOR};
+	constexpr Registry ZMM23 {ZWORD, 0b10111, Registry::VECTOR};
+	constexpr Registry ZMM24 {ZWORD, 0b11000, Registry::VECTOR | Registry::REX};
+	constexpr Registry ZMM25 {ZWORD, 0b11001, Registry::VECTOR | Registry::REX};
+	constexpr Registry ZMM26 {ZWORD, 0b11010, Registry::VECTOR | Registry::REX};
+	constexpr Registry ZMM27 {ZWORD, 0b11011, Registry::VECTOR | Registry::REX};
+	constexpr Registry ZMM28 {ZWORD, 0b11100, Registry::VECTOR | Registry::REX};
+	constexpr Registry ZMM29 {ZWORD, 0b11101, Registry::VECTOR | Registry::REX};
+	constexpr Registry ZMM30 {ZWORD, 0b11110, Registry::VECTOR | Registry::REX};
+	constexpr Registry ZMM31 {ZWORD, 0b11111, Registry::VECTOR | Registry::REX};
+
+	constexpr Registry K0    {QWORD, 0b0000, Registry::MASK};
+	constexpr Registry K1    {QWORD, 0b0001, Registry::MASK};
+	constexpr Registry K2    {QWORD, 0b0010, Registry::MASK};
+	constexpr Registry K3    {QWORD, 0b0011, Registry::MASK};
+	constexpr Registry K4    {QWORD, 0b0100, Registry::MASK};
+	constexpr Registry K5    {QWORD, 0b0101, Registry::MASK};
+	constexpr Registry K6    {QWORD, 0b0110, Registry::MASK};
+	constexpr Registry K7    {QWORD, 0b0111, Registry::MASK};
+
+	/// Register names accepted by the assembler, lookup is case-insensitive
+	constexpr auto REGISTRY_NAMES = util::name_table<Registry>({
+		{"eax", EAX},
+		{"ax", AX},
+		{"al", AL},
+		{"ah", AH},
+		{"ebx", EBX},
+		{"bx", BX},
+		{"bl", BL},
+		{"bh", BH},
+		{"ecx", ECX},
+		{"cx", CX},
+		{"cl", CL},
+		{"ch", CH},
+		{"edx", EDX},
+		{"dx", DX},
+		{"dl", DL},
+		{"dh", DH},
+		{"esi", ESI},
+		{"si", SI},
+		{"edi", EDI},
+		{"di", DI},
+		{"ebp", EBP},
+		{"bp", BP},
+		{"esp", ESP},
+		{"sp", SP},
+		{"st", ST},
+		{"spl", SPL},
+		{"bpl", BPL},
+		{"sil", SIL},
+		{"dil", DIL},
+		{"rax", RAX},
+		{"rbx", RBX},
+		{"rcx", RCX},
+		{"rdx", RDX},
+		{"rsi", RSI},
+		{"rdi", RDI},
+		{"rbp", RBP},
+		{"rsp", RSP},
+		{"r8l", R8L},
+		{"r8w", R8W},
+		{"r8d", R8D},
+		{"r8", R8},
+		{"r9l", R9L},
+		{"r9w", R9W},
+		{"r9d", R9D},
+		{"r9", R9},
+		{"r10l", R10L},
+		{"r10w", R10W},
+		{"r10d", R10D},
+		{"r10", R10},
+		{"r11l", R11L},
+		{"r11w", R11W},
+		{"r11d", R11D},
+		{"r11", R11},
+		{"r12l", R12L},
+		{"r12w", R12W},
+		{"r12d", R12D},
+		{"r12", R12},
+		{"r13l", R13L},
+		{"r13w", R13W},
+		{"r13d", R13D},
+		{"r13", R13},
+		{"r14l", R14L},
+		{"r14w", R14W},
+		{"r14d", R14D},
+		{"r14", R14},
+		{"r15l", R15L},
+		{"r15w", R15W},
+		{"r15d", R15D},
+		{"r15", R15},
+		{"xmm0", XMM0},
+		{"xmm1", XMM1},
+		{"xmm2", XMM2},
+		{"xmm3", XMM3},
+		{"xmm4", XMM4},
+		{"xmm5", XMM5},
+		{"xmm6", XMM6},
+		{"xmm7", XMM7},
+		{"xmm8", XMM8},
+		{"xmm9", XMM9},
+		{"xmm10", XMM10},
+		{"xmm11", XMM11},
+		{"xmm12", XMM12},
+		{"xmm13", XMM13},
+		{"xmm14", XMM14},
+		{"xmm15", XMM15},
+		{"ymm0", YMM0},
+		{"ymm1", YMM1},
+		{"ymm2", YMM2},
+		{"ymm3", YMM3},
+		{"ymm4", YMM4},
+		{"ymm5", YMM5},
+		{"ymm6", YMM6},
+		{"ymm7", YMM7},
+		{"ymm8", YMM8},
+		{"ymm9", YMM9},
+		{"ymm10", YMM10},
+		{"ymm11", YMM11},
+		{"ymm12", YMM12},
+		{"ymm13", YMM13},
+		{"ymm14", YMM14},
+		{"ymm15", YMM15},
+		{"xmm16", XMM16},
+		{"xmm17", XMM17},
+		{"xmm18", XMM18},
+		{"xmm19", XMM19},
+		{"xmm20", XMM20},
+		{"xmm21", XMM21},
+		{"xmm22", XMM22},
+		{"xmm23", XMM23},
+		{"xmm24", XMM24},
+		{"xmm25", XMM25},
+		{"xmm26", XMM26},
+		{"xmm27", XMM27},
+		{"xmm28", XMM28},
+		{"xmm29", XMM29},
+		{"xmm30", XMM30},
+		{"xmm31", XMM31},
+		{"ymm16", YMM16},
+		{"ymm17", YMM17},
+		{"ymm18", YMM18},
+		{"ymm19", YMM19},
+		{"ymm20", YMM20},
+		{"ymm21", YMM21},
+		{"ymm22", YMM22},
+		{"ymm23", YMM23},
+		{"ymm24", YMM24},
+		{"ymm25", YMM25},
+		{"ymm26", YMM26},
+		{"ymm27", YMM27},
+		{"ymm28", YMM28},
+		{"ymm29", YMM29},
+		{"ymm30", YMM30},
+		{"ymm31", YMM31},
+		{"zmm0", ZMM0},
+		{"zmm1", ZMM1},
+		{"zmm2", ZMM2},
+		{"zmm3", ZMM3},
+		{"zmm4", ZMM4},
+		{"zmm5", ZMM5},
+		{"zmm6", ZMM6},
+		{"zmm7", ZMM7},
+		{"zmm8", ZMM8},
+		{"zmm9", ZMM9},
+		{"zmm10", ZMM10},
+		{"zmm11", ZMM11},
+		{"zmm12", ZMM12},
+		{"zmm13", ZMM13},
+		{"zmm14", ZMM14},
+		{"zmm15", ZMM15},
+		{"zmm16", ZMM16},
+		{"zmm17", ZMM17},
+		{"zmm18", ZMM18},
+		{"zmm19", ZMM19},
+		{"zmm20", ZMM20},
+		{"zmm21", ZMM21},
+		{"zmm22", ZMM22},
+		{"zmm23", ZMM23},
+		{"zmm24", ZMM24},
+		{"zmm25", ZMM25},
+		{"zmm26", ZMM26},
+		{"zmm27", ZMM27},
+		{"zmm28", ZMM28},
+		{"zmm29", ZMM29},
+		{"zmm30", ZMM30},
+		{"zmm31", ZMM31},
+		{"k0", K0},
+		{"k1", K1},
+		{"k2", K2},
+		{"k3", K3},
+		{"k4", K4},
+		{"k5", K5},
+		{"k6", K6},
+		{"k7", K7}
+	});
+
 }
\ No newline at end of file
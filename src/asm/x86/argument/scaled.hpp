@@ -10,8 +10,9 @@ namespace asmio::x86 {
 	constexpr void check_valid_scale(Registry registry, uint8_t scale) {
 
 		// use .reg not .low() on purpose, as only RSP/EBP can't be
-		// used in index, R12 (0b1100) is fine as the REX extension is decoded
-		if (registry.reg == NO_SIB_INDEX) {
+		// used in index, R12 (0b1100) is fine as the REX extension is decoded,
+		// vector registers used by VSIB addressing have no such restriction
+		if (registry.reg == NO_SIB_INDEX && !registry.is(Registry::VECTOR)) {
 			throw std::runtime_error {"Invalid operand, RSP/ESP can't be used as scaled index!"};
 		}
 
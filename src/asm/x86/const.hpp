@@ -25,6 +25,9 @@ namespace asmio::x86 {
 	/// High (REX) bit of the register number
 	constexpr uint8_t REG_HIGH     = 0b1000;
 
+	/// Highest (EVEX) bit of the register number, only the AVX-512 vector registers use it
+	constexpr uint8_t REG_EVEX     = 0b10000;
+
 	/// placed in the SIB byte's 'index' to mark the lack of index (makes SIB just a base holder)
 	constexpr uint8_t NO_SIB_INDEX = 0b100;
 
@@ -94,4 +97,13 @@ namespace asmio::x86 {
 	/// Often used as a prefix byte before instructions
 	constexpr uint8_t LONG_OPCODE  = 0x0F;
 
+	/// The first byte of the two byte VEX prefix
+	constexpr uint8_t VEX_SHORT    = 0xC5;
+
+	/// The first byte of the three byte VEX prefix
+	constexpr uint8_t VEX_LONG     = 0xC4;
+
+	/// The first byte of the four byte EVEX prefix
+	constexpr uint8_t EVEX         = 0x62;
+
 }
\ No newline at end of file
@@ -0,0 +1,1047 @@
+#include "asm/x86/writer.hpp"
+
+namespace asmio::x86 {
+
+	/// Zero Upper Bits of YMM Registers
+	void BufferWriter::put_vzeroupper() {
+		put_byte(VEX_SHORT);
+		put_byte(0xF8);
+		put_byte(0x77);
+	}
+
+	/// Zero All YMM Registers
+	void BufferWriter::put_vzeroall() {
+		put_byte(VEX_SHORT);
+		put_byte(0xFC);
+		put_byte(0x77);
+	}
+
+	/// Move Aligned Packed Single-Precision Floats
+	void BufferWriter::put_vmovaps(Location dst, Location src) {
+		put_inst_avx_mov(0, 0x28, 0x29, dst, src, Evex::full_mem(DWORD));
+	}
+
+	/// Move Unaligned Packed Single-Precision Floats
+	void BufferWriter::put_vmovups(Location dst, Location src) {
+		put_inst_avx_mov(0, 0x10, 0x11, dst, src, Evex::full_mem(DWORD));
+	}
+
+	/// Move Aligned Packed Double-Precision Floats
+	void BufferWriter::put_vmovapd(Location dst, Location src) {
+		put_inst_avx_mov(0x66, 0x28, 0x29, dst, src, Evex::full_mem(QWORD));
+	}
+
+	/// Move Unaligned Packed Double-Precision Floats
+	void BufferWriter::put_vmovupd(Location dst, Location src) {
+		put_inst_avx_mov(0x66, 0x10, 0x11, dst, src, Evex::full_mem(QWORD));
+	}
+
+	/// Move Aligned Packed Integers
+	void BufferWriter::put_vmovdqa(Location dst, Location src) {
+		put_inst_avx_mov(0x66, 0x6F, 0x7F, dst, src);
+	}
+
+	/// Move Unaligned Packed Integers
+	void BufferWriter::put_vmovdqu(Location dst, Location src) {
+		put_inst_avx_mov(0xF3, 0x6F, 0x7F, dst, src);
+	}
+
+	/// Move Doubleword
+	void BufferWriter::put_vmovd(Location dst, Location src) {
+
+		if (dst.is_vector() && dst.size == XWORD && src.is_memreg() && (src.size == DWORD || src.size == VOID)) {
+			put_inst_vex_std(0x66, 0x6E, src, dst.base.pack(), 0, false, false);
+			return;
+		}
+
+		if (dst.is_memreg() && (dst.size == DWORD || dst.size == VOID) && src.is_vector() && src.size == XWORD) {
+			put_inst_vex_std(0x66, 0x7E, dst, src.base.pack(), 0, false, false);
+			return;
+		}
+
+		throw std::runtime_error {"Invalid operands"};
+
+	}
+
+	/// Move Quadword
+	void BufferWriter::put_vmovq(Location dst, Location src) {
+
+		if (dst.is_vector() && dst.size == XWORD && src.is_simple() && src.size == QWORD) {
+			put_inst_vex_std(0x66, 0x6E, src, dst.base.pack(), 0, false, true);
+			return;
+		}
+
+		if (dst.is_simple() && dst.size == QWORD && src.is_vector() && src.size == XWORD) {
+			put_inst_vex_std(0x66, 0x7E, dst, src.base.pack(), 0, false, true);
+			return;
+		}
+
+		if (dst.is_memory() && src.is_vector() && src.size == XWORD) {
+			put_inst_vex_std(0x66, 0xD6, dst, src.base.pack(), 0, false, false);
+			return;
+		}
+
+		if (dst.size != XWORD) {
+			throw std::runtime_error {"Invalid operands"};
+		}
+
+		put_inst_avx_unary(0xF3, 0x7E, dst, src);
+
+	}
+
+	/// Move Byte Mask
+	void BufferWriter::put_vpmovmskb(Location dst, Location src) {
+
+		if (!dst.is_simple() || !src.is_vector() || (dst.size != DWORD && dst.size != QWORD)) {
+			throw std::runtime_error {"Invalid operands"};
+		}
+
+		put_inst_vex_std(0x66, 0xD7, src, dst.base.pack(), 0, src.size == YWORD, false);
+
+	}
+
+	/// Extract Packed Single-Precision Float Sign Mask
+	void BufferWriter::put_vmovmskps(Location dst, Location src) {
+
+		if (!dst.is_simple() || !src.is_vector() || (dst.size != DWORD && dst.size != QWORD)) {
+			throw std::runtime_error {"Invalid operands"};
+		}
+
+		put_inst_vex_std(0, 0x50, src, dst.base.pack(), 0, src.size == YWORD, false);
+
+	}
+
+	/// Add Packed Single-Precision Floats
+	void BufferWriter::put_vaddps(Location dst, Location src1, Location src2) {
+		put_inst_avx(0, 0x58, dst, src1, src2, 0, false, Evex::full(DWORD));
+	}
+
+	/// Add Packed Double-Precision Floats
+	void BufferWriter::put_vaddpd(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x58, dst, src1, src2, 0, false, Evex::full(QWORD));
+	}
+
+	/// Add Scalar Single-Precision Float
+	void BufferWriter::put_vaddss(Location dst, Location src1, Location src2) {
+		put_inst_avx_scalar(0xF3, 0x58, dst, src1, src2, 0, false, Evex::scalar(DWORD));
+	}
+
+	/// Add Scalar Double-Precision Float
+	void BufferWriter::put_vaddsd(Location dst, Location src1, Location src2) {
+		put_inst_avx_scalar(0xF2, 0x58, dst, src1, src2, 0, false, Evex::scalar(QWORD));
+	}
+
+	/// Subtract Packed Single-Precision Floats
+	void BufferWriter::put_vsubps(Location dst, Location src1, Location src2) {
+		put_inst_avx(0, 0x5C, dst, src1, src2, 0, false, Evex::full(DWORD));
+	}
+
+	/// Subtract Packed Double-Precision Floats
+	void BufferWriter::put_vsubpd(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x5C, dst, src1, src2, 0, false, Evex::full(QWORD));
+	}
+
+	/// Subtract Scalar Single-Precision Float
+	void BufferWriter::put_vsubss(Location dst, Location src1, Location src2) {
+		put_inst_avx_scalar(0xF3, 0x5C, dst, src1, src2, 0, false, Evex::scalar(DWORD));
+	}
+
+	/// Subtract Scalar Double-Precision Float
+	void BufferWriter::put_vsubsd(Location dst, Location src1, Location src2) {
+		put_inst_avx_scalar(0xF2, 0x5C, dst, src1, src2, 0, false, Evex::scalar(QWORD));
+	}
+
+	/// Multiply Packed Single-Precision Floats
+	void BufferWriter::put_vmulps(Location dst, Location src1, Location src2) {
+		put_inst_avx(0, 0x59, dst, src1, src2, 0, false, Evex::full(DWORD));
+	}
+
+	/// Multiply Packed Double-Precision Floats
+	void BufferWriter::put_vmulpd(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x59, dst, src1, src2, 0, false, Evex::full(QWORD));
+	}
+
+	/// Multiply Scalar Single-Precision Float
+	void BufferWriter::put_vmulss(Location dst, Location src1, Location src2) {
+		put_inst_avx_scalar(0xF3, 0x59, dst, src1, src2, 0, false, Evex::scalar(DWORD));
+	}
+
+	/// Multiply Scalar Double-Precision Float
+	void BufferWriter::put_vmulsd(Location dst, Location src1, Location src2) {
+		put_inst_avx_scalar(0xF2, 0x59, dst, src1, src2, 0, false, Evex::scalar(QWORD));
+	}
+
+	/// Divide Packed Single-Precision Floats
+	void BufferWriter::put_vdivps(Location dst, Location src1, Location src2) {
+		put_inst_avx(0, 0x5E, dst, src1, src2, 0, false, Evex::full(DWORD));
+	}
+
+	/// Divide Packed Double-Precision Floats
+	void BufferWriter::put_vdivpd(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x5E, dst, src1, src2, 0, false, Evex::full(QWORD));
+	}
+
+	/// Divide Scalar Single-Precision Float
+	void BufferWriter::put_vdivss(Location dst, Location src1, Location src2) {
+		put_inst_avx_scalar(0xF3, 0x5E, dst, src1, src2, 0, false, Evex::scalar(DWORD));
+	}
+
+	/// Divide Scalar Double-Precision Float
+	void BufferWriter::put_vdivsd(Location dst, Location src1, Location src2) {
+		put_inst_avx_scalar(0xF2, 0x5E, dst, src1, src2, 0, false, Evex::scalar(QWORD));
+	}
+
+	/// Minimum of Packed Single-Precision Floats
+	void BufferWriter::put_vminps(Location dst, Location src1, Location src2) {
+		put_inst_avx(0, 0x5D, dst, src1, src2, 0, false, Evex::full(DWORD));
+	}
+
+	/// Minimum of Packed Double-Precision Floats
+	void BufferWriter::put_vminpd(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x5D, dst, src1, src2, 0, false, Evex::full(QWORD));
+	}
+
+	/// Minimum of Scalar Single-Precision Float
+	void BufferWriter::put_vminss(Location dst, Location src1, Location src2) {
+		put_inst_avx_scalar(0xF3, 0x5D, dst, src1, src2, 0, false, Evex::scalar(DWORD));
+	}
+
+	/// Minimum of Scalar Double-Precision Float
+	void BufferWriter::put_vminsd(Location dst, Location src1, Location src2) {
+		put_inst_avx_scalar(0xF2, 0x5D, dst, src1, src2, 0, false, Evex::scalar(QWORD));
+	}
+
+	/// Maximum of Packed Single-Precision Floats
+	void BufferWriter::put_vmaxps(Location dst, Location src1, Location src2) {
+		put_inst_avx(0, 0x5F, dst, src1, src2, 0, false, Evex::full(DWORD));
+	}
+
+	/// Maximum of Packed Double-Precision Floats
+	void BufferWriter::put_vmaxpd(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x5F, dst, src1, src2, 0, false, Evex::full(QWORD));
+	}
+
+	/// Maximum of Scalar Single-Precision Float
+	void BufferWriter::put_vmaxss(Location dst, Location src1, Location src2) {
+		put_inst_avx_scalar(0xF3, 0x5F, dst, src1, src2, 0, false, Evex::scalar(DWORD));
+	}
+
+	/// Maximum of Scalar Double-Precision Float
+	void BufferWriter::put_vmaxsd(Location dst, Location src1, Location src2) {
+		put_inst_avx_scalar(0xF2, 0x5F, dst, src1, src2, 0, false, Evex::scalar(QWORD));
+	}
+
+	/// Square Root of Packed Single-Precision Floats
+	void BufferWriter::put_vsqrtps(Location dst, Location src) {
+		put_inst_avx_unary(0, 0x51, dst, src, 0, false, Evex::full(DWORD));
+	}
+
+	/// Square Root of Packed Double-Precision Floats
+	void BufferWriter::put_vsqrtpd(Location dst, Location src) {
+		put_inst_avx_unary(0x66, 0x51, dst, src, 0, false, Evex::full(QWORD));
+	}
+
+	/// Square Root of Scalar Single-Precision Float
+	void BufferWriter::put_vsqrtss(Location dst, Location src1, Location src2) {
+		put_inst_avx_scalar(0xF3, 0x51, dst, src1, src2, 0, false, Evex::scalar(DWORD));
+	}
+
+	/// Square Root of Scalar Double-Precision Float
+	void BufferWriter::put_vsqrtsd(Location dst, Location src1, Location src2) {
+		put_inst_avx_scalar(0xF2, 0x51, dst, src1, src2, 0, false, Evex::scalar(QWORD));
+	}
+
+	/// Bitwise AND of Packed Single-Precision Floats
+	void BufferWriter::put_vandps(Location dst, Location src1, Location src2) {
+		put_inst_avx(0, 0x54, dst, src1, src2, 0, false, Evex::full(DWORD));
+	}
+
+	/// Bitwise AND of Packed Double-Precision Floats
+	void BufferWriter::put_vandpd(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x54, dst, src1, src2, 0, false, Evex::full(QWORD));
+	}
+
+	/// Bitwise AND NOT of Packed Single-Precision Floats
+	void BufferWriter::put_vandnps(Location dst, Location src1, Location src2) {
+		put_inst_avx(0, 0x55, dst, src1, src2, 0, false, Evex::full(DWORD));
+	}
+
+	/// Bitwise AND NOT of Packed Double-Precision Floats
+	void BufferWriter::put_vandnpd(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x55, dst, src1, src2, 0, false, Evex::full(QWORD));
+	}
+
+	/// Bitwise OR of Packed Single-Precision Floats
+	void BufferWriter::put_vorps(Location dst, Location src1, Location src2) {
+		put_inst_avx(0, 0x56, dst, src1, src2, 0, false, Evex::full(DWORD));
+	}
+
+	/// Bitwise OR of Packed Double-Precision Floats
+	void BufferWriter::put_vorpd(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x56, dst, src1, src2, 0, false, Evex::full(QWORD));
+	}
+
+	/// Bitwise XOR of Packed Single-Precision Floats
+	void BufferWriter::put_vxorps(Location dst, Location src1, Location src2) {
+		put_inst_avx(0, 0x57, dst, src1, src2, 0, false, Evex::full(DWORD));
+	}
+
+	/// Bitwise XOR of Packed Double-Precision Floats
+	void BufferWriter::put_vxorpd(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x57, dst, src1, src2, 0, false, Evex::full(QWORD));
+	}
+
+	/// Compare Packed Single-Precision Floats, using the predicate given as immediate
+	void BufferWriter::put_vcmpps(Location dst, Location src1, Location src2, Location imm) {
+		put_inst_avx_imm(0, 0xC2, dst, src1, src2, imm, 0, false, Evex::full(DWORD));
+	}
+
+	/// Compare Packed Double-Precision Floats, using the predicate given as immediate
+	void BufferWriter::put_vcmppd(Location dst, Location src1, Location src2, Location imm) {
+		put_inst_avx_imm(0x66, 0xC2, dst, src1, src2, imm, 0, false, Evex::full(QWORD));
+	}
+
+	/// Shuffle Packed Single-Precision Floats
+	void BufferWriter::put_vshufps(Location dst, Location src1, Location src2, Location imm) {
+		put_inst_avx_imm(0, 0xC6, dst, src1, src2, imm, 0, false, Evex::full(DWORD));
+	}
+
+	/// Shuffle Packed Double-Precision Floats
+	void BufferWriter::put_vshufpd(Location dst, Location src1, Location src2, Location imm) {
+		put_inst_avx_imm(0x66, 0xC6, dst, src1, src2, imm, 0, false, Evex::full(QWORD));
+	}
+
+	/// Convert Packed Doubleword Integers to Packed Single-Precision Floats
+	void BufferWriter::put_vcvtdq2ps(Location dst, Location src) {
+		put_inst_avx_unary(0, 0x5B, dst, src, 0, false, Evex::full(DWORD));
+	}
+
+	/// Convert Packed Single-Precision Floats to Packed Doubleword Integers
+	void BufferWriter::put_vcvtps2dq(Location dst, Location src) {
+		put_inst_avx_unary(0x66, 0x5B, dst, src, 0, false, Evex::full(DWORD));
+	}
+
+	/// Convert with Truncation Packed Single-Precision Floats to Packed Doubleword Integers
+	void BufferWriter::put_vcvttps2dq(Location dst, Location src) {
+		put_inst_avx_unary(0xF3, 0x5B, dst, src, 0, false, Evex::full(DWORD));
+	}
+
+	/// Fused Multiply-Add of Packed Single-Precision Floats, dst = dst * src2 + src1
+	void BufferWriter::put_vfmadd132ps(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x98, dst, src1, src2, 0x38, false, Evex::full(DWORD));
+	}
+
+	/// Fused Multiply-Add of Packed Double-Precision Floats, dst = dst * src2 + src1
+	void BufferWriter::put_vfmadd132pd(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x98, dst, src1, src2, 0x38, true, Evex::full(QWORD));
+	}
+
+	/// Fused Multiply-Add of Scalar Single-Precision Float, dst = dst * src2 + src1
+	void BufferWriter::put_vfmadd132ss(Location dst, Location src1, Location src2) {
+		put_inst_avx_scalar(0x66, 0x99, dst, src1, src2, 0x38, false, Evex::scalar(DWORD));
+	}
+
+	/// Fused Multiply-Add of Scalar Double-Precision Float, dst = dst * src2 + src1
+	void BufferWriter::put_vfmadd132sd(Location dst, Location src1, Location src2) {
+		put_inst_avx_scalar(0x66, 0x99, dst, src1, src2, 0x38, true, Evex::scalar(QWORD));
+	}
+
+	/// Fused Multiply-Add of Packed Single-Precision Floats, dst = src1 * dst + src2
+	void BufferWriter::put_vfmadd213ps(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0xA8, dst, src1, src2, 0x38, false, Evex::full(DWORD));
+	}
+
+	/// Fused Multiply-Add of Packed Double-Precision Floats, dst = src1 * dst + src2
+	void BufferWriter::put_vfmadd213pd(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0xA8, dst, src1, src2, 0x38, true, Evex::full(QWORD));
+	}
+
+	/// Fused Multiply-Add of Scalar Single-Precision Float, dst = src1 * dst + src2
+	void BufferWriter::put_vfmadd213ss(Location dst, Location src1, Location src2) {
+		put_inst_avx_scalar(0x66, 0xA9, dst, src1, src2, 0x38, false, Evex::scalar(DWORD));
+	}
+
+	/// Fused Multiply-Add of Scalar Double-Precision Float, dst = src1 * dst + src2
+	void BufferWriter::put_vfmadd213sd(Location dst, Location src1, Location src2) {
+		put_inst_avx_scalar(0x66, 0xA9, dst, src1, src2, 0x38, true, Evex::scalar(QWORD));
+	}
+
+	/// Fused Multiply-Add of Packed Single-Precision Floats, dst = src1 * src2 + dst
+	void BufferWriter::put_vfmadd231ps(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0xB8, dst, src1, src2, 0x38, false, Evex::full(DWORD));
+	}
+
+	/// Fused Multiply-Add of Packed Double-Precision Floats, dst = src1 * src2 + dst
+	void BufferWriter::put_vfmadd231pd(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0xB8, dst, src1, src2, 0x38, true, Evex::full(QWORD));
+	}
+
+	/// Fused Multiply-Add of Scalar Single-Precision Float, dst = src1 * src2 + dst
+	void BufferWriter::put_vfmadd231ss(Location dst, Location src1, Location src2) {
+		put_inst_avx_scalar(0x66, 0xB9, dst, src1, src2, 0x38, false, Evex::scalar(DWORD));
+	}
+
+	/// Fused Multiply-Add of Scalar Double-Precision Float, dst = src1 * src2 + dst
+	void BufferWriter::put_vfmadd231sd(Location dst, Location src1, Location src2) {
+		put_inst_avx_scalar(0x66, 0xB9, dst, src1, src2, 0x38, true, Evex::scalar(QWORD));
+	}
+
+	/// Fused Multiply-Subtract of Packed Single-Precision Floats, dst = dst * src2 - src1
+	void BufferWriter::put_vfmsub132ps(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x9A, dst, src1, src2, 0x38, false, Evex::full(DWORD));
+	}
+
+	/// Fused Multiply-Subtract of Packed Double-Precision Floats, dst = dst * src2 - src1
+	void BufferWriter::put_vfmsub132pd(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x9A, dst, src1, src2, 0x38, true, Evex::full(QWORD));
+	}
+
+	/// Fused Multiply-Subtract of Scalar Single-Precision Float, dst = dst * src2 - src1
+	void BufferWriter::put_vfmsub132ss(Location dst, Location src1, Location src2) {
+		put_inst_avx_scalar(0x66, 0x9B, dst, src1, src2, 0x38, false, Evex::scalar(DWORD));
+	}
+
+	/// Fused Multiply-Subtract of Scalar Double-Precision Float, dst = dst * src2 - src1
+	void BufferWriter::put_vfmsub132sd(Location dst, Location src1, Location src2) {
+		put_inst_avx_scalar(0x66, 0x9B, dst, src1, src2, 0x38, true, Evex::scalar(QWORD));
+	}
+
+	/// Fused Multiply-Subtract of Packed Single-Precision Floats, dst = src1 * dst - src2
+	void BufferWriter::put_vfmsub213ps(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0xAA, dst, src1, src2, 0x38, false, Evex::full(DWORD));
+	}
+
+	/// Fused Multiply-Subtract of Packed Double-Precision Floats, dst = src1 * dst - src2
+	void BufferWriter::put_vfmsub213pd(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0xAA, dst, src1, src2, 0x38, true, Evex::full(QWORD));
+	}
+
+	/// Fused Multiply-Subtract of Scalar Single-Precision Float, dst = src1 * dst - src2
+	void BufferWriter::put_vfmsub213ss(Location dst, Location src1, Location src2) {
+		put_inst_avx_scalar(0x66, 0xAB, dst, src1, src2, 0x38, false, Evex::scalar(DWORD));
+	}
+
+	/// Fused Multiply-Subtract of Scalar Double-Precision Float, dst = src1 * dst - src2
+	void BufferWriter::put_vfmsub213sd(Location dst, Location src1, Location src2) {
+		put_inst_avx_scalar(0x66, 0xAB, dst, src1, src2, 0x38, true, Evex::scalar(QWORD));
+	}
+
+	/// Fused Multiply-Subtract of Packed Single-Precision Floats, dst = src1 * src2 - dst
+	void BufferWriter::put_vfmsub231ps(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0xBA, dst, src1, src2, 0x38, false, Evex::full(DWORD));
+	}
+
+	/// Fused Multiply-Subtract of Packed Double-Precision Floats, dst = src1 * src2 - dst
+	void BufferWriter::put_vfmsub231pd(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0xBA, dst, src1, src2, 0x38, true, Evex::full(QWORD));
+	}
+
+	/// Fused Multiply-Subtract of Scalar Single-Precision Float, dst = src1 * src2 - dst
+	void BufferWriter::put_vfmsub231ss(Location dst, Location src1, Location src2) {
+		put_inst_avx_scalar(0x66, 0xBB, dst, src1, src2, 0x38, false, Evex::scalar(DWORD));
+	}
+
+	/// Fused Multiply-Subtract of Scalar Double-Precision Float, dst = src1 * src2 - dst
+	void BufferWriter::put_vfmsub231sd(Location dst, Location src1, Location src2) {
+		put_inst_avx_scalar(0x66, 0xBB, dst, src1, src2, 0x38, true, Evex::scalar(QWORD));
+	}
+
+	/// Fused Negative Multiply-Add of Packed Single-Precision Floats, dst = -(dst * src2) + src1
+	void BufferWriter::put_vfnmadd132ps(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x9C, dst, src1, src2, 0x38, false, Evex::full(DWORD));
+	}
+
+	/// Fused Negative Multiply-Add of Packed Double-Precision Floats, dst = -(dst * src2) + src1
+	void BufferWriter::put_vfnmadd132pd(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x9C, dst, src1, src2, 0x38, true, Evex::full(QWORD));
+	}
+
+	/// Fused Negative Multiply-Add of Scalar Single-Precision Float, dst = -(dst * src2) + src1
+	void BufferWriter::put_vfnmadd132ss(Location dst, Location src1, Location src2) {
+		put_inst_avx_scalar(0x66, 0x9D, dst, src1, src2, 0x38, false, Evex::scalar(DWORD));
+	}
+
+	/// Fused Negative Multiply-Add of Scalar Double-Precision Float, dst = -(dst * src2) + src1
+	void BufferWriter::put_vfnmadd132sd(Location dst, Location src1, Location src2) {
+		put_inst_avx_scalar(0x66, 0x9D, dst, src1, src2, 0x38, true, Evex::scalar(QWORD));
+	}
+
+	/// Fused Negative Multiply-Add of Packed Single-Precision Floats, dst = -(src1 * dst) + src2
+	void BufferWriter::put_vfnmadd213ps(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0xAC, dst, src1, src2, 0x38, false, Evex::full(DWORD));
+	}
+
+	/// Fused Negative Multiply-Add of Packed Double-Precision Floats, dst = -(src1 * dst) + src2
+	void BufferWriter::put_vfnmadd213pd(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0xAC, dst, src1, src2, 0x38, true, Evex::full(QWORD));
+	}
+
+	/// Fused Negative Multiply-Add of Scalar Single-Precision Float, dst = -(src1 * dst) + src2
+	void BufferWriter::put_vfnmadd213ss(Location dst, Location src1, Location src2) {
+		put_inst_avx_scalar(0x66, 0xAD, dst, src1, src2, 0x38, false, Evex::scalar(DWORD));
+	}
+
+	/// Fused Negative Multiply-Add of Scalar Double-Precision Float, dst = -(src1 * dst) + src2
+	void BufferWriter::put_vfnmadd213sd(Location dst, Location src1, Location src2) {
+		put_inst_avx_scalar(0x66, 0xAD, dst, src1, src2, 0x38, true, Evex::scalar(QWORD));
+	}
+
+	/// Fused Negative Multiply-Add of Packed Single-Precision Floats, dst = -(src1 * src2) + dst
+	void BufferWriter::put_vfnmadd231ps(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0xBC, dst, src1, src2, 0x38, false, Evex::full(DWORD));
+	}
+
+	/// Fused Negative Multiply-Add of Packed Double-Precision Floats, dst = -(src1 * src2) + dst
+	void BufferWriter::put_vfnmadd231pd(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0xBC, dst, src1, src2, 0x38, true, Evex::full(QWORD));
+	}
+
+	/// Fused Negative Multiply-Add of Scalar Single-Precision Float, dst = -(src1 * src2) + dst
+	void BufferWriter::put_vfnmadd231ss(Location dst, Location src1, Location src2) {
+		put_inst_avx_scalar(0x66, 0xBD, dst, src1, src2, 0x38, false, Evex::scalar(DWORD));
+	}
+
+	/// Fused Negative Multiply-Add of Scalar Double-Precision Float, dst = -(src1 * src2) + dst
+	void BufferWriter::put_vfnmadd231sd(Location dst, Location src1, Location src2) {
+		put_inst_avx_scalar(0x66, 0xBD, dst, src1, src2, 0x38, true, Evex::scalar(QWORD));
+	}
+
+	/// Fused Negative Multiply-Subtract of Packed Single-Precision Floats, dst = -(dst * src2) - src1
+	void BufferWriter::put_vfnmsub132ps(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x9E, dst, src1, src2, 0x38, false, Evex::full(DWORD));
+	}
+
+	/// Fused Negative Multiply-Subtract of Packed Double-Precision Floats, dst = -(dst * src2) - src1
+	void BufferWriter::put_vfnmsub132pd(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x9E, dst, src1, src2, 0x38, true, Evex::full(QWORD));
+	}
+
+	/// Fused Negative Multiply-Subtract of Scalar Single-Precision Float, dst = -(dst * src2) - src1
+	void BufferWriter::put_vfnmsub132ss(Location dst, Location src1, Location src2) {
+		put_inst_avx_scalar(0x66, 0x9F, dst, src1, src2, 0x38, false, Evex::scalar(DWORD));
+	}
+
+	/// Fused Negative Multiply-Subtract of Scalar Double-Precision Float, dst = -(dst * src2) - src1
+	void BufferWriter::put_vfnmsub132sd(Location dst, Location src1, Location src2) {
+		put_inst_avx_scalar(0x66, 0x9F, dst, src1, src2, 0x38, true, Evex::scalar(QWORD));
+	}
+
+	/// Fused Negative Multiply-Subtract of Packed Single-Precision Floats, dst = -(src1 * dst) - src2
+	void BufferWriter::put_vfnmsub213ps(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0xAE, dst, src1, src2, 0x38, false, Evex::full(DWORD));
+	}
+
+	/// Fused Negative Multiply-Subtract of Packed Double-Precision Floats, dst = -(src1 * dst) - src2
+	void BufferWriter::put_vfnmsub213pd(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0xAE, dst, src1, src2, 0x38, true, Evex::full(QWORD));
+	}
+
+	/// Fused Negative Multiply-Subtract of Scalar Single-Precision Float, dst = -(src1 * dst) - src2
+	void BufferWriter::put_vfnmsub213ss(Location dst, Location src1, Location src2) {
+		put_inst_avx_scalar(0x66, 0xAF, dst, src1, src2, 0x38, false, Evex::scalar(DWORD));
+	}
+
+	/// Fused Negative Multiply-Subtract of Scalar Double-Precision Float, dst = -(src1 * dst) - src2
+	void BufferWriter::put_vfnmsub213sd(Location dst, Location src1, Location src2) {
+		put_inst_avx_scalar(0x66, 0xAF, dst, src1, src2, 0x38, true, Evex::scalar(QWORD));
+	}
+
+	/// Fused Negative Multiply-Subtract of Packed Single-Precision Floats, dst = -(src1 * src2) - dst
+	void BufferWriter::put_vfnmsub231ps(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0xBE, dst, src1, src2, 0x38, false, Evex::full(DWORD));
+	}
+
+	/// Fused Negative Multiply-Subtract of Packed Double-Precision Floats, dst = -(src1 * src2) - dst
+	void BufferWriter::put_vfnmsub231pd(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0xBE, dst, src1, src2, 0x38, true, Evex::full(QWORD));
+	}
+
+	/// Fused Negative Multiply-Subtract of Scalar Single-Precision Float, dst = -(src1 * src2) - dst
+	void BufferWriter::put_vfnmsub231ss(Location dst, Location src1, Location src2) {
+		put_inst_avx_scalar(0x66, 0xBF, dst, src1, src2, 0x38, false, Evex::scalar(DWORD));
+	}
+
+	/// Fused Negative Multiply-Subtract of Scalar Double-Precision Float, dst = -(src1 * src2) - dst
+	void BufferWriter::put_vfnmsub231sd(Location dst, Location src1, Location src2) {
+		put_inst_avx_scalar(0x66, 0xBF, dst, src1, src2, 0x38, true, Evex::scalar(QWORD));
+	}
+
+	/// Add Packed Byte Integers
+	void BufferWriter::put_vpaddb(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0xFC, dst, src1, src2, 0, false, Evex::full_mem(BYTE));
+	}
+
+	/// Add Packed Word Integers
+	void BufferWriter::put_vpaddw(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0xFD, dst, src1, src2, 0, false, Evex::full_mem(WORD));
+	}
+
+	/// Add Packed Doubleword Integers
+	void BufferWriter::put_vpaddd(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0xFE, dst, src1, src2, 0, false, Evex::full(DWORD));
+	}
+
+	/// Add Packed Quadword Integers
+	void BufferWriter::put_vpaddq(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0xD4, dst, src1, src2, 0, false, Evex::full(QWORD));
+	}
+
+	/// Subtract Packed Byte Integers
+	void BufferWriter::put_vpsubb(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0xF8, dst, src1, src2, 0, false, Evex::full_mem(BYTE));
+	}
+
+	/// Subtract Packed Word Integers
+	void BufferWriter::put_vpsubw(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0xF9, dst, src1, src2, 0, false, Evex::full_mem(WORD));
+	}
+
+	/// Subtract Packed Doubleword Integers
+	void BufferWriter::put_vpsubd(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0xFA, dst, src1, src2, 0, false, Evex::full(DWORD));
+	}
+
+	/// Subtract Packed Quadword Integers
+	void BufferWriter::put_vpsubq(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0xFB, dst, src1, src2, 0, false, Evex::full(QWORD));
+	}
+
+	/// Multiply Packed Word Integers and Store Low Result
+	void BufferWriter::put_vpmullw(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0xD5, dst, src1, src2, 0, false, Evex::full_mem(WORD));
+	}
+
+	/// Multiply Packed Doubleword Integers and Store Low Result
+	void BufferWriter::put_vpmulld(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x40, dst, src1, src2, 0x38, false, Evex::full(DWORD));
+	}
+
+	/// Multiply Packed Unsigned Doubleword Integers into Quadwords
+	void BufferWriter::put_vpmuludq(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0xF4, dst, src1, src2, 0, false, Evex::full(QWORD));
+	}
+
+	/// Bitwise AND
+	void BufferWriter::put_vpand(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0xDB, dst, src1, src2);
+	}
+
+	/// Bitwise AND NOT
+	void BufferWriter::put_vpandn(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0xDF, dst, src1, src2);
+	}
+
+	/// Bitwise OR
+	void BufferWriter::put_vpor(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0xEB, dst, src1, src2);
+	}
+
+	/// Bitwise XOR
+	void BufferWriter::put_vpxor(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0xEF, dst, src1, src2);
+	}
+
+	/// Compare Packed Bytes for Equal
+	void BufferWriter::put_vpcmpeqb(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x74, dst, src1, src2, 0, false, Evex::full_mem(BYTE));
+	}
+
+	/// Compare Packed Words for Equal
+	void BufferWriter::put_vpcmpeqw(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x75, dst, src1, src2, 0, false, Evex::full_mem(WORD));
+	}
+
+	/// Compare Packed Doublewords for Equal
+	void BufferWriter::put_vpcmpeqd(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x76, dst, src1, src2, 0, false, Evex::full(DWORD));
+	}
+
+	/// Compare Packed Quadwords for Equal
+	void BufferWriter::put_vpcmpeqq(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x29, dst, src1, src2, 0x38, false, Evex::full(QWORD));
+	}
+
+	/// Compare Packed Signed Bytes for Greater Than
+	void BufferWriter::put_vpcmpgtb(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x64, dst, src1, src2, 0, false, Evex::full_mem(BYTE));
+	}
+
+	/// Compare Packed Signed Words for Greater Than
+	void BufferWriter::put_vpcmpgtw(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x65, dst, src1, src2, 0, false, Evex::full_mem(WORD));
+	}
+
+	/// Compare Packed Signed Doublewords for Greater Than
+	void BufferWriter::put_vpcmpgtd(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x66, dst, src1, src2, 0, false, Evex::full(DWORD));
+	}
+
+	/// Compare Packed Signed Quadwords for Greater Than
+	void BufferWriter::put_vpcmpgtq(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x37, dst, src1, src2, 0x38, false, Evex::full(QWORD));
+	}
+
+	/// Minimum of Packed Unsigned Bytes
+	void BufferWriter::put_vpminub(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0xDA, dst, src1, src2, 0, false, Evex::full_mem(BYTE));
+	}
+
+	/// Maximum of Packed Unsigned Bytes
+	void BufferWriter::put_vpmaxub(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0xDE, dst, src1, src2, 0, false, Evex::full_mem(BYTE));
+	}
+
+	/// Minimum of Packed Signed Doublewords
+	void BufferWriter::put_vpminsd(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x39, dst, src1, src2, 0x38, false, Evex::full(DWORD));
+	}
+
+	/// Maximum of Packed Signed Doublewords
+	void BufferWriter::put_vpmaxsd(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x3D, dst, src1, src2, 0x38, false, Evex::full(DWORD));
+	}
+
+	/// Minimum of Packed Unsigned Doublewords
+	void BufferWriter::put_vpminud(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x3B, dst, src1, src2, 0x38, false, Evex::full(DWORD));
+	}
+
+	/// Maximum of Packed Unsigned Doublewords
+	void BufferWriter::put_vpmaxud(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x3F, dst, src1, src2, 0x38, false, Evex::full(DWORD));
+	}
+
+	/// Unpack and Interleave Low-Order Bytes
+	void BufferWriter::put_vpunpcklbw(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x60, dst, src1, src2, 0, false, Evex::full_mem(BYTE));
+	}
+
+	/// Unpack and Interleave Low-Order Words
+	void BufferWriter::put_vpunpcklwd(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x61, dst, src1, src2, 0, false, Evex::full_mem(WORD));
+	}
+
+	/// Unpack and Interleave Low-Order Doublewords
+	void BufferWriter::put_vpunpckldq(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x62, dst, src1, src2, 0, false, Evex::full(DWORD));
+	}
+
+	/// Unpack and Interleave Low-Order Quadwords
+	void BufferWriter::put_vpunpcklqdq(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x6C, dst, src1, src2, 0, false, Evex::full(QWORD));
+	}
+
+	/// Unpack and Interleave High-Order Bytes
+	void BufferWriter::put_vpunpckhbw(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x68, dst, src1, src2, 0, false, Evex::full_mem(BYTE));
+	}
+
+	/// Unpack and Interleave High-Order Words
+	void BufferWriter::put_vpunpckhwd(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x69, dst, src1, src2, 0, false, Evex::full_mem(WORD));
+	}
+
+	/// Unpack and Interleave High-Order Doublewords
+	void BufferWriter::put_vpunpckhdq(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x6A, dst, src1, src2, 0, false, Evex::full(DWORD));
+	}
+
+	/// Unpack and Interleave High-Order Quadwords
+	void BufferWriter::put_vpunpckhqdq(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x6D, dst, src1, src2, 0, false, Evex::full(QWORD));
+	}
+
+	/// Pack Words into Bytes with Signed Saturation
+	void BufferWriter::put_vpacksswb(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x63, dst, src1, src2, 0, false, Evex::full_mem(WORD));
+	}
+
+	/// Pack Doublewords into Words with Signed Saturation
+	void BufferWriter::put_vpackssdw(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x6B, dst, src1, src2, 0, false, Evex::full(DWORD));
+	}
+
+	/// Pack Words into Bytes with Unsigned Saturation
+	void BufferWriter::put_vpackuswb(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x67, dst, src1, src2, 0, false, Evex::full_mem(WORD));
+	}
+
+	/// Shuffle Packed Bytes
+	void BufferWriter::put_vpshufb(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x00, dst, src1, src2, 0x38, false, Evex::full_mem(BYTE));
+	}
+
+	/// Variable Shift Packed Doublewords Left Logical
+	void BufferWriter::put_vpsllvd(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x47, dst, src1, src2, 0x38, false, Evex::full(DWORD));
+	}
+
+	/// Variable Shift Packed Quadwords Left Logical
+	void BufferWriter::put_vpsllvq(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x47, dst, src1, src2, 0x38, true, Evex::full(QWORD));
+	}
+
+	/// Variable Shift Packed Doublewords Right Logical
+	void BufferWriter::put_vpsrlvd(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x45, dst, src1, src2, 0x38, false, Evex::full(DWORD));
+	}
+
+	/// Variable Shift Packed Quadwords Right Logical
+	void BufferWriter::put_vpsrlvq(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x45, dst, src1, src2, 0x38, true, Evex::full(QWORD));
+	}
+
+	/// Variable Shift Packed Doublewords Right Arithmetic
+	void BufferWriter::put_vpsravd(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x46, dst, src1, src2, 0x38, false, Evex::full(DWORD));
+	}
+
+	/// Shift Packed Words Left Logical
+	void BufferWriter::put_vpsllw(Location dst, Location src, Location cnt) {
+		put_inst_avx_shift(0xF1, 0x71, 0b110, dst, src, cnt, Evex::full_mem(WORD));
+	}
+
+	/// Shift Packed Doublewords Left Logical
+	void BufferWriter::put_vpslld(Location dst, Location src, Location cnt) {
+		put_inst_avx_shift(0xF2, 0x72, 0b110, dst, src, cnt, Evex::full(DWORD));
+	}
+
+	/// Shift Packed Quadwords Left Logical
+	void BufferWriter::put_vpsllq(Location dst, Location src, Location cnt) {
+		put_inst_avx_shift(0xF3, 0x73, 0b110, dst, src, cnt, Evex::full(QWORD));
+	}
+
+	/// Shift Packed Words Right Logical
+	void BufferWriter::put_vpsrlw(Location dst, Location src, Location cnt) {
+		put_inst_avx_shift(0xD1, 0x71, 0b010, dst, src, cnt, Evex::full_mem(WORD));
+	}
+
+	/// Shift Packed Doublewords Right Logical
+	void BufferWriter::put_vpsrld(Location dst, Location src, Location cnt) {
+		put_inst_avx_shift(0xD2, 0x72, 0b010, dst, src, cnt, Evex::full(DWORD));
+	}
+
+	/// Shift Packed Quadwords Right Logical
+	void BufferWriter::put_vpsrlq(Location dst, Location src, Location cnt) {
+		put_inst_avx_shift(0xD3, 0x73, 0b010, dst, src, cnt, Evex::full(QWORD));
+	}
+
+	/// Shift Packed Words Right Arithmetic
+	void BufferWriter::put_vpsraw(Location dst, Location src, Location cnt) {
+		put_inst_avx_shift(0xE1, 0x71, 0b100, dst, src, cnt, Evex::full_mem(WORD));
+	}
+
+	/// Shift Packed Doublewords Right Arithmetic
+	void BufferWriter::put_vpsrad(Location dst, Location src, Location cnt) {
+		put_inst_avx_shift(0xE2, 0x72, 0b100, dst, src, cnt, Evex::full(DWORD));
+	}
+
+	/// Shift Double Quadwords Left Logical, by bytes
+	void BufferWriter::put_vpslldq(Location dst, Location src, Location cnt) {
+		put_inst_avx_shift(0, 0x73, 0b111, dst, src, cnt, Evex::full_mem(BYTE));
+	}
+
+	/// Shift Double Quadwords Right Logical, by bytes
+	void BufferWriter::put_vpsrldq(Location dst, Location src, Location cnt) {
+		put_inst_avx_shift(0, 0x73, 0b011, dst, src, cnt, Evex::full_mem(BYTE));
+	}
+
+	/// Logical Compare and set ZF and CF
+	void BufferWriter::put_vptest(Location dst, Location src) {
+		put_inst_avx_unary(0x66, 0x17, dst, src, 0x38);
+	}
+
+	/// Shuffle Packed Doublewords
+	void BufferWriter::put_vpshufd(Location dst, Location src, Location imm) {
+		put_inst_avx_unary_imm(0x66, 0x70, dst, src, imm, 0, false, Evex::full(DWORD));
+	}
+
+	/// Shuffle Packed Low Words
+	void BufferWriter::put_vpshuflw(Location dst, Location src, Location imm) {
+		put_inst_avx_unary_imm(0xF2, 0x70, dst, src, imm, 0, false, Evex::full_mem(WORD));
+	}
+
+	/// Shuffle Packed High Words
+	void BufferWriter::put_vpshufhw(Location dst, Location src, Location imm) {
+		put_inst_avx_unary_imm(0xF3, 0x70, dst, src, imm, 0, false, Evex::full_mem(WORD));
+	}
+
+	/// Packed Align Right
+	void BufferWriter::put_vpalignr(Location dst, Location src1, Location src2, Location imm) {
+		put_inst_avx_imm(0x66, 0x0F, dst, src1, src2, imm, 0x3A, false, Evex::full_mem(BYTE));
+	}
+
+	/// Blend Packed Doublewords
+	void BufferWriter::put_vpblendd(Location dst, Location src1, Location src2, Location imm) {
+		put_inst_avx_imm(0x66, 0x02, dst, src1, src2, imm, 0x3A);
+	}
+
+	/// Permute Doublewords, using the indices in src1
+	void BufferWriter::put_vpermd(Location dst, Location src1, Location src2) {
+
+		if (dst.size == XWORD) {
+			throw std::runtime_error {"Invalid operands, expected AVX or AVX-512 registers"};
+		}
+
+		put_inst_avx(0x66, 0x36, dst, src1, src2, 0x38, false, Evex::full(DWORD));
+
+	}
+
+	/// Permute Single-Precision Floats, using the indices in src1
+	void BufferWriter::put_vpermps(Location dst, Location src1, Location src2) {
+
+		if (dst.size == XWORD) {
+			throw std::runtime_error {"Invalid operands, expected AVX or AVX-512 registers"};
+		}
+
+		put_inst_avx(0x66, 0x16, dst, src1, src2, 0x38, false, Evex::full(DWORD));
+
+	}
+
+	/// Permute Quadwords
+	void BufferWriter::put_vpermq(Location dst, Location src, Location imm) {
+
+		if (dst.size == XWORD) {
+			throw std::runtime_error {"Invalid operands, expected AVX or AVX-512 registers"};
+		}
+
+		put_inst_avx_unary_imm(0x66, 0x00, dst, src, imm, 0x3A, true, Evex::full(QWORD));
+
+	}
+
+	/// Permute Double-Precision Floats
+	void BufferWriter::put_vpermpd(Location dst, Location src, Location imm) {
+
+		if (dst.size == XWORD) {
+			throw std::runtime_error {"Invalid operands, expected AVX or AVX-512 registers"};
+		}
+
+		put_inst_avx_unary_imm(0x66, 0x01, dst, src, imm, 0x3A, true, Evex::full(QWORD));
+
+	}
+
+	/// Permute 128 bit Integer Lanes
+	void BufferWriter::put_vperm2i128(Location dst, Location src1, Location src2, Location imm) {
+
+		if (dst.size != YWORD) {
+			throw std::runtime_error {"Invalid operands, expected AVX registers"};
+		}
+
+		put_inst_avx_imm(0x66, 0x46, dst, src1, src2, imm, 0x3A);
+
+	}
+
+	/// Insert 128 bit Integer Lane
+	void BufferWriter::put_vinserti128(Location dst, Location src1, Location src2, Location imm) {
+
+		if (!dst.is_vector() || !src1.is_vector() || dst.size != YWORD || src1.size != YWORD || !((src2.is_vector() && src2.size == XWORD) || src2.is_memory()) || !imm.is_immediate()) {
+			throw std::runtime_error {"Invalid operands"};
+		}
+
+		set_suffix(1);
+		put_inst_vex_std(0x66, 0x38, src2, dst.base.pack(), src1.base.reg, true, false, 0x3A);
+		put_byte(imm.offset);
+
+	}
+
+	/// Extract 128 bit Integer Lane
+	void BufferWriter::put_vextracti128(Location dst, Location src, Location imm) {
+
+		if (!((dst.is_vector() && dst.size == XWORD) || dst.is_memory()) || !src.is_vector() || src.size != YWORD || !imm.is_immediate()) {
+			throw std::runtime_error {"Invalid operands"};
+		}
+
+		set_suffix(1);
+		put_inst_vex_std(0x66, 0x39, dst, src.base.pack(), 0, true, false, 0x3A);
+		put_byte(imm.offset);
+
+	}
+
+	/// Broadcast Byte
+	void BufferWriter::put_vpbroadcastb(Location dst, Location src) {
+		put_inst_avx_broadcast(0x78, dst, src, true, Evex::scalar(BYTE));
+	}
+
+	/// Broadcast Word
+	void BufferWriter::put_vpbroadcastw(Location dst, Location src) {
+		put_inst_avx_broadcast(0x79, dst, src, true, Evex::scalar(WORD));
+	}
+
+	/// Broadcast Doubleword
+	void BufferWriter::put_vpbroadcastd(Location dst, Location src) {
+		put_inst_avx_broadcast(0x58, dst, src, true, Evex::scalar(DWORD));
+	}
+
+	/// Broadcast Quadword
+	void BufferWriter::put_vpbroadcastq(Location dst, Location src) {
+		put_inst_avx_broadcast(0x59, dst, src, true, Evex::scalar(QWORD));
+	}
+
+	/// Broadcast Single-Precision Float
+	void BufferWriter::put_vbroadcastss(Location dst, Location src) {
+		put_inst_avx_broadcast(0x18, dst, src, true, Evex::scalar(DWORD));
+	}
+
+	/// Broadcast Double-Precision Float
+	void BufferWriter::put_vbroadcastsd(Location dst, Location src) {
+
+		if (dst.size == XWORD) {
+			throw std::runtime_error {"Invalid operands, expected AVX or AVX-512 registers"};
+		}
+
+		put_inst_avx_broadcast(0x19, dst, src, true, Evex::scalar(QWORD));
+
+	}
+
+	/// Broadcast 128 bits of Integer Data
+	void BufferWriter::put_vbroadcasti128(Location dst, Location src) {
+
+		if (dst.size != YWORD) {
+			throw std::runtime_error {"Invalid operands, expected AVX registers"};
+		}
+
+		put_inst_avx_broadcast(0x5A, dst, src, false);
+
+	}
+
+	/// Gather Doublewords using Doubleword Indices
+	void BufferWriter::put_vpgatherdd(Location dst, Location src, Location mask) {
+		put_inst_avx_gather(0x90, false, dst, src, mask);
+	}
+
+	/// Gather Quadwords using Doubleword Indices
+	void BufferWriter::put_vpgatherdq(Location dst, Location src, Location mask) {
+		put_inst_avx_gather(0x90, true, dst, src, mask);
+	}
+
+	/// Gather Doublewords using Quadword Indices
+	void BufferWriter::put_vpgatherqd(Location dst, Location src, Location mask) {
+		put_inst_avx_gather(0x91, false, dst, src, mask);
+	}
+
+	/// Gather Quadwords using Quadword Indices
+	void BufferWriter::put_vpgatherqq(Location dst, Location src, Location mask) {
+		put_inst_avx_gather(0x91, true, dst, src, mask);
+	}
+
+	/// Gather Single-Precision Floats using Doubleword Indices
+	void BufferWriter::put_vgatherdps(Location dst, Location src, Location mask) {
+		put_inst_avx_gather(0x92, false, dst, src, mask);
+	}
+
+	/// Gather Double-Precision Floats using Doubleword Indices
+	void BufferWriter::put_vgatherdpd(Location dst, Location src, Location mask) {
+		put_inst_avx_gather(0x92, true, dst, src, mask);
+	}
+
+	/// Gather Single-Precision Floats using Quadword Indices
+	void BufferWriter::put_vgatherqps(Location dst, Location src, Location mask) {
+		put_inst_avx_gather(0x93, false, dst, src, mask);
+	}
+
+	/// Gather Double-Precision Floats using Quadword Indices
+	void BufferWriter::put_vgatherqpd(Location dst, Location src, Location mask) {
+		put_inst_avx_gather(0x93, true, dst, src, mask);
+	}
+
+}
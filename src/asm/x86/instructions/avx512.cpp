@@ -0,0 +1,355 @@
+#include "asm/x86/writer.hpp"
+
+namespace asmio::x86 {
+
+	/// Move Aligned Packed Doublewords
+	void BufferWriter::put_vmovdqa32(Location dst, Location src) {
+		put_inst_avx_mov(0x66, 0x6F, 0x7F, dst, src, Evex::full_mem(DWORD).only());
+	}
+
+	/// Move Aligned Packed Quadwords
+	void BufferWriter::put_vmovdqa64(Location dst, Location src) {
+		put_inst_avx_mov(0x66, 0x6F, 0x7F, dst, src, Evex::full_mem(QWORD).only());
+	}
+
+	/// Move Unaligned Packed Bytes
+	void BufferWriter::put_vmovdqu8(Location dst, Location src) {
+		put_inst_avx_mov(0xF2, 0x6F, 0x7F, dst, src, Evex {Evex::FULL_MEM, BYTE, false, true});
+	}
+
+	/// Move Unaligned Packed Words
+	void BufferWriter::put_vmovdqu16(Location dst, Location src) {
+		put_inst_avx_mov(0xF2, 0x6F, 0x7F, dst, src, Evex {Evex::FULL_MEM, WORD, true, true});
+	}
+
+	/// Move Unaligned Packed Doublewords
+	void BufferWriter::put_vmovdqu32(Location dst, Location src) {
+		put_inst_avx_mov(0xF3, 0x6F, 0x7F, dst, src, Evex::full_mem(DWORD).only());
+	}
+
+	/// Move Unaligned Packed Quadwords
+	void BufferWriter::put_vmovdqu64(Location dst, Location src) {
+		put_inst_avx_mov(0xF3, 0x6F, 0x7F, dst, src, Evex::full_mem(QWORD).only());
+	}
+
+	/// Bitwise AND of Packed Doublewords
+	void BufferWriter::put_vpandd(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0xDB, dst, src1, src2, 0, false, Evex::full(DWORD).only());
+	}
+
+	/// Bitwise AND of Packed Quadwords
+	void BufferWriter::put_vpandq(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0xDB, dst, src1, src2, 0, false, Evex::full(QWORD).only());
+	}
+
+	/// Bitwise AND NOT of Packed Doublewords
+	void BufferWriter::put_vpandnd(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0xDF, dst, src1, src2, 0, false, Evex::full(DWORD).only());
+	}
+
+	/// Bitwise AND NOT of Packed Quadwords
+	void BufferWriter::put_vpandnq(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0xDF, dst, src1, src2, 0, false, Evex::full(QWORD).only());
+	}
+
+	/// Bitwise OR of Packed Doublewords
+	void BufferWriter::put_vpord(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0xEB, dst, src1, src2, 0, false, Evex::full(DWORD).only());
+	}
+
+	/// Bitwise OR of Packed Quadwords
+	void BufferWriter::put_vporq(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0xEB, dst, src1, src2, 0, false, Evex::full(QWORD).only());
+	}
+
+	/// Bitwise XOR of Packed Doublewords
+	void BufferWriter::put_vpxord(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0xEF, dst, src1, src2, 0, false, Evex::full(DWORD).only());
+	}
+
+	/// Bitwise XOR of Packed Quadwords
+	void BufferWriter::put_vpxorq(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0xEF, dst, src1, src2, 0, false, Evex::full(QWORD).only());
+	}
+
+	/// Bitwise Ternary Logic of Packed Doublewords, the immediate is the truth table
+	void BufferWriter::put_vpternlogd(Location dst, Location src1, Location src2, Location imm) {
+		put_inst_avx_imm(0x66, 0x25, dst, src1, src2, imm, 0x3A, false, Evex::full(DWORD).only());
+	}
+
+	/// Bitwise Ternary Logic of Packed Quadwords, the immediate is the truth table
+	void BufferWriter::put_vpternlogq(Location dst, Location src1, Location src2, Location imm) {
+		put_inst_avx_imm(0x66, 0x25, dst, src1, src2, imm, 0x3A, false, Evex::full(QWORD).only());
+	}
+
+	/// Compare Packed Signed Doublewords into Mask
+	void BufferWriter::put_vpcmpd(Location dst, Location src1, Location src2, Location imm) {
+		put_inst_avx_imm(0x66, 0x1F, dst, src1, src2, imm, 0x3A, false, Evex::full(DWORD).only());
+	}
+
+	/// Compare Packed Unsigned Doublewords into Mask
+	void BufferWriter::put_vpcmpud(Location dst, Location src1, Location src2, Location imm) {
+		put_inst_avx_imm(0x66, 0x1E, dst, src1, src2, imm, 0x3A, false, Evex::full(DWORD).only());
+	}
+
+	/// Compare Packed Signed Quadwords into Mask
+	void BufferWriter::put_vpcmpq(Location dst, Location src1, Location src2, Location imm) {
+		put_inst_avx_imm(0x66, 0x1F, dst, src1, src2, imm, 0x3A, false, Evex::full(QWORD).only());
+	}
+
+	/// Compare Packed Unsigned Quadwords into Mask
+	void BufferWriter::put_vpcmpuq(Location dst, Location src1, Location src2, Location imm) {
+		put_inst_avx_imm(0x66, 0x1E, dst, src1, src2, imm, 0x3A, false, Evex::full(QWORD).only());
+	}
+
+	/// Logical AND of Packed Doublewords and Set Mask
+	void BufferWriter::put_vptestmd(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x27, dst, src1, src2, 0x38, false, Evex::full(DWORD).only());
+	}
+
+	/// Logical AND of Packed Quadwords and Set Mask
+	void BufferWriter::put_vptestmq(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x27, dst, src1, src2, 0x38, false, Evex::full(QWORD).only());
+	}
+
+	/// Logical NAND of Packed Doublewords and Set Mask
+	void BufferWriter::put_vptestnmd(Location dst, Location src1, Location src2) {
+		put_inst_avx(0xF3, 0x27, dst, src1, src2, 0x38, false, Evex::full(DWORD).only());
+	}
+
+	/// Logical NAND of Packed Quadwords and Set Mask
+	void BufferWriter::put_vptestnmq(Location dst, Location src1, Location src2) {
+		put_inst_avx(0xF3, 0x27, dst, src1, src2, 0x38, false, Evex::full(QWORD).only());
+	}
+
+	/// Blend Packed Doublewords using an Opmask
+	void BufferWriter::put_vpblendmd(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x64, dst, src1, src2, 0x38, false, Evex::full(DWORD).only());
+	}
+
+	/// Blend Packed Quadwords using an Opmask
+	void BufferWriter::put_vpblendmq(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x64, dst, src1, src2, 0x38, false, Evex::full(QWORD).only());
+	}
+
+	/// Blend Packed Single-Precision Floats using an Opmask
+	void BufferWriter::put_vblendmps(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x65, dst, src1, src2, 0x38, false, Evex::full(DWORD).only());
+	}
+
+	/// Blend Packed Double-Precision Floats using an Opmask
+	void BufferWriter::put_vblendmpd(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x65, dst, src1, src2, 0x38, false, Evex::full(QWORD).only());
+	}
+
+	/// Store Sparse Packed Doublewords into Dense Memory
+	void BufferWriter::put_vpcompressd(Location dst, Location src) {
+		put_inst_avx_compress(0x8B, DWORD, dst, src);
+	}
+
+	/// Store Sparse Packed Quadwords into Dense Memory
+	void BufferWriter::put_vpcompressq(Location dst, Location src) {
+		put_inst_avx_compress(0x8B, QWORD, dst, src);
+	}
+
+	/// Load Sparse Packed Doublewords from Dense Memory
+	void BufferWriter::put_vpexpandd(Location dst, Location src) {
+		put_inst_avx_unary(0x66, 0x89, dst, src, 0x38, false, Evex::scalar(DWORD).only());
+	}
+
+	/// Load Sparse Packed Quadwords from Dense Memory
+	void BufferWriter::put_vpexpandq(Location dst, Location src) {
+		put_inst_avx_unary(0x66, 0x89, dst, src, 0x38, false, Evex::scalar(QWORD).only());
+	}
+
+	/// Minimum of Packed Signed Quadwords
+	void BufferWriter::put_vpminsq(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x39, dst, src1, src2, 0x38, false, Evex::full(QWORD).only());
+	}
+
+	/// Maximum of Packed Signed Quadwords
+	void BufferWriter::put_vpmaxsq(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x3D, dst, src1, src2, 0x38, false, Evex::full(QWORD).only());
+	}
+
+	/// Minimum of Packed Unsigned Quadwords
+	void BufferWriter::put_vpminuq(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x3B, dst, src1, src2, 0x38, false, Evex::full(QWORD).only());
+	}
+
+	/// Maximum of Packed Unsigned Quadwords
+	void BufferWriter::put_vpmaxuq(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x3F, dst, src1, src2, 0x38, false, Evex::full(QWORD).only());
+	}
+
+	/// Multiply Packed Quadwords and Store Low Result
+	void BufferWriter::put_vpmullq(Location dst, Location src1, Location src2) {
+		put_inst_avx(0x66, 0x40, dst, src1, src2, 0x38, false, Evex::full(QWORD).only());
+	}
+
+	/// Shift Packed Quadwords Right Arithmetic
+	void BufferWriter::put_vpsraq(Location dst, Location src, Location cnt) {
+		put_inst_avx_shift(0xE2, 0x72, 0b100, dst, src, cnt, Evex::full(QWORD).only());
+	}
+
+	/// Move 8 bit Mask
+	void BufferWriter::put_kmovb(Location dst, Location src) {
+		put_inst_kmov(BYTE, dst, src);
+	}
+
+	/// Move 16 bit Mask
+	void BufferWriter::put_kmovw(Location dst, Location src) {
+		put_inst_kmov(WORD, dst, src);
+	}
+
+	/// Move 32 bit Mask
+	void BufferWriter::put_kmovd(Location dst, Location src) {
+		put_inst_kmov(DWORD, dst, src);
+	}
+
+	/// Move 64 bit Mask
+	void BufferWriter::put_kmovq(Location dst, Location src) {
+		put_inst_kmov(QWORD, dst, src);
+	}
+
+	/// Bitwise AND of 8 bit Masks
+	void BufferWriter::put_kandb(Location dst, Location src1, Location src2) {
+		put_inst_opmask(0x41, BYTE, dst, src1, src2);
+	}
+
+	/// Bitwise AND of 16 bit Masks
+	void BufferWriter::put_kandw(Location dst, Location src1, Location src2) {
+		put_inst_opmask(0x41, WORD, dst, src1, src2);
+	}
+
+	/// Bitwise AND of 32 bit Masks
+	void BufferWriter::put_kandd(Location dst, Location src1, Location src2) {
+		put_inst_opmask(0x41, DWORD, dst, src1, src2);
+	}
+
+	/// Bitwise AND of 64 bit Masks
+	void BufferWriter::put_kandq(Location dst, Location src1, Location src2) {
+		put_inst_opmask(0x41, QWORD, dst, src1, src2);
+	}
+
+	/// Bitwise AND NOT of 8 bit Masks
+	void BufferWriter::put_kandnb(Location dst, Location src1, Location src2) {
+		put_inst_opmask(0x42, BYTE, dst, src1, src2);
+	}
+
+	/// Bitwise AND NOT of 16 bit Masks
+	void BufferWriter::put_kandnw(Location dst, Location src1, Location src2) {
+		put_inst_opmask(0x42, WORD, dst, src1, src2);
+	}
+
+	/// Bitwise AND NOT of 32 bit Masks
+	void BufferWriter::put_kandnd(Location dst, Location src1, Location src2) {
+		put_inst_opmask(0x42, DWORD, dst, src1, src2);
+	}
+
+	/// Bitwise AND NOT of 64 bit Masks
+	void BufferWriter::put_kandnq(Location dst, Location src1, Location src2) {
+		put_inst_opmask(0x42, QWORD, dst, src1, src2);
+	}
+
+	/// Bitwise OR of 8 bit Masks
+	void BufferWriter::put_korb(Location dst, Location src1, Location src2) {
+		put_inst_opmask(0x45, BYTE, dst, src1, src2);
+	}
+
+	/// Bitwise OR of 16 bit Masks
+	void BufferWriter::put_korw(Location dst, Location src1, Location src2) {
+		put_inst_opmask(0x45, WORD, dst, src1, src2);
+	}
+
+	/// Bitwise OR of 32 bit Masks
+	void BufferWriter::put_kord(Location dst, Location src1, Location src2) {
+		put_inst_opmask(0x45, DWORD, dst, src1, src2);
+	}
+
+	/// Bitwise OR of 64 bit Masks
+	void BufferWriter::put_korq(Location dst, Location src1, Location src2) {
+		put_inst_opmask(0x45, QWORD, dst, src1, src2);
+	}
+
+	/// Bitwise XNOR of 8 bit Masks
+	void BufferWriter::put_kxnorb(Location dst, Location src1, Location src2) {
+		put_inst_opmask(0x46, BYTE, dst, src1, src2);
+	}
+
+	/// Bitwise XNOR of 16 bit Masks
+	void BufferWriter::put_kxnorw(Location dst, Location src1, Location src2) {
+		put_inst_opmask(0x46, WORD, dst, src1, src2);
+	}
+
+	/// Bitwise XNOR of 32 bit Masks
+	void BufferWriter::put_kxnord(Location dst, Location src1, Location src2) {
+		put_inst_opmask(0x46, DWORD, dst, src1, src2);
+	}
+
+	/// Bitwise XNOR of 64 bit Masks
+	void BufferWriter::put_kxnorq(Location dst, Location src1, Location src2) {
+		put_inst_opmask(0x46, QWORD, dst, src1, src2);
+	}
+
+	/// Bitwise XOR of 8 bit Masks
+	void BufferWriter::put_kxorb(Location dst, Location src1, Location src2) {
+		put_inst_opmask(0x47, BYTE, dst, src1, src2);
+	}
+
+	/// Bitwise XOR of 16 bit Masks
+	void BufferWriter::put_kxorw(Location dst, Location src1, Location src2) {
+		put_inst_opmask(0x47, WORD, dst, src1, src2);
+	}
+
+	/// Bitwise XOR of 32 bit Masks
+	void BufferWriter::put_kxord(Location dst, Location src1, Location src2) {
+		put_inst_opmask(0x47, DWORD, dst, src1, src2);
+	}
+
+	/// Bitwise XOR of 64 bit Masks
+	void BufferWriter::put_kxorq(Location dst, Location src1, Location src2) {
+		put_inst_opmask(0x47, QWORD, dst, src1, src2);
+	}
+
+	/// Bitwise NOT of 8 bit Mask
+	void BufferWriter::put_knotb(Location dst, Location src) {
+		put_inst_opmask_unary(0x44, BYTE, dst, src);
+	}
+
+	/// Bitwise NOT of 16 bit Mask
+	void BufferWriter::put_knotw(Location dst, Location src) {
+		put_inst_opmask_unary(0x44, WORD, dst, src);
+	}
+
+	/// Bitwise NOT of 32 bit Mask
+	void BufferWriter::put_knotd(Location dst, Location src) {
+		put_inst_opmask_unary(0x44, DWORD, dst, src);
+	}
+
+	/// Bitwise NOT of 64 bit Mask
+	void BufferWriter::put_knotq(Location dst, Location src) {
+		put_inst_opmask_unary(0x44, QWORD, dst, src);
+	}
+
+	/// OR 8 bit Masks and Set Flags
+	void BufferWriter::put_kortestb(Location dst, Location src) {
+		put_inst_opmask_unary(0x98, BYTE, dst, src);
+	}
+
+	/// OR 16 bit Masks and Set Flags
+	void BufferWriter::put_kortestw(Location dst, Location src) {
+		put_inst_opmask_unary(0x98, WORD, dst, src);
+	}
+
+	/// OR 32 bit Masks and Set Flags
+	void BufferWriter::put_kortestd(Location dst, Location src) {
+		put_inst_opmask_unary(0x98, DWORD, dst, src);
+	}
+
+	/// OR 64 bit Masks and Set Flags
+	void BufferWriter::put_kortestq(Location dst, Location src) {
+		put_inst_opmask_unary(0x98, QWORD, dst, src);
+	}
+
+}
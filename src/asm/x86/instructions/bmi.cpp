@@ -0,0 +1,123 @@
+#include "asm/x86/writer.hpp"
+
+namespace asmio::x86 {
+
+	/// Population Count
+	void BufferWriter::put_popcnt(Location dst, Location src) {
+		put_inst_bit_count(0xB8, dst, src);
+	}
+
+	/// Count Leading Zero Bits
+	void BufferWriter::put_lzcnt(Location dst, Location src) {
+		put_inst_bit_count(0xBD, dst, src);
+	}
+
+	/// Count Trailing Zero Bits
+	void BufferWriter::put_tzcnt(Location dst, Location src) {
+		put_inst_bit_count(0xBC, dst, src);
+	}
+
+	/// Bitwise AND NOT, the first source is inverted
+	void BufferWriter::put_andn(Location dst, Location src1, Location src2) {
+		put_inst_bmi(0, 0xF2, dst, src1, src2);
+	}
+
+	/// Bit Field Extract, start and length are in the control register
+	void BufferWriter::put_bextr(Location dst, Location src, Location ctl) {
+		put_inst_bmi(0, 0xF7, dst, ctl, src);
+	}
+
+	/// Extract Lowest Set Bit
+	void BufferWriter::put_blsi(Location dst, Location src) {
+		put_inst_bmi_unary(0xF3, 0b011, dst, src);
+	}
+
+	/// Mask Up to Lowest Set Bit
+	void BufferWriter::put_blsmsk(Location dst, Location src) {
+		put_inst_bmi_unary(0xF3, 0b010, dst, src);
+	}
+
+	/// Reset Lowest Set Bit
+	void BufferWriter::put_blsr(Location dst, Location src) {
+		put_inst_bmi_unary(0xF3, 0b001, dst, src);
+	}
+
+	/// Zero High Bits Starting with Specified Bit Position
+	void BufferWriter::put_bzhi(Location dst, Location src, Location idx) {
+		put_inst_bmi(0, 0xF5, dst, idx, src);
+	}
+
+	/// Parallel Bits Deposit
+	void BufferWriter::put_pdep(Location dst, Location src, Location mask) {
+		put_inst_bmi(0xF2, 0xF5, dst, src, mask);
+	}
+
+	/// Parallel Bits Extract
+	void BufferWriter::put_pext(Location dst, Location src, Location mask) {
+		put_inst_bmi(0xF3, 0xF5, dst, src, mask);
+	}
+
+	/// Shift Left Logical Without Affecting Flags
+	void BufferWriter::put_shlx(Location dst, Location src, Location cnt) {
+		put_inst_bmi(0x66, 0xF7, dst, cnt, src);
+	}
+
+	/// Shift Right Logical Without Affecting Flags
+	void BufferWriter::put_shrx(Location dst, Location src, Location cnt) {
+		put_inst_bmi(0xF2, 0xF7, dst, cnt, src);
+	}
+
+	/// Shift Right Arithmetic Without Affecting Flags
+	void BufferWriter::put_sarx(Location dst, Location src, Location cnt) {
+		put_inst_bmi(0xF3, 0xF7, dst, cnt, src);
+	}
+
+	/// Rotate Right Without Affecting Flags
+	void BufferWriter::put_rorx(Location dst, Location src, Location imm) {
+
+		if (dst.size != DWORD && dst.size != QWORD) {
+			throw std::runtime_error {"Invalid operand size, expected dword or qword"};
+		}
+
+		if (!dst.is_simple() || !src.is_memreg() || !imm.is_immediate() || pair_size(dst, src) != dst.size) {
+			throw std::runtime_error {"Invalid operands"};
+		}
+
+		set_suffix(1);
+		put_inst_vex_std(0xF2, 0xF0, src, dst.base.pack(), 0, false, dst.size == QWORD, 0x3A);
+		put_byte(imm.offset);
+
+	}
+
+	/// Unsigned Multiply by EDX/RDX Without Affecting Flags
+	void BufferWriter::put_mulx(Location high, Location low, Location src) {
+		put_inst_bmi(0xF2, 0xF6, high, low, src);
+	}
+
+	/// Add with Carry Flag, only affects CF
+	void BufferWriter::put_adcx(Location dst, Location src) {
+
+		const uint8_t size = pair_size(dst, src);
+
+		if (!dst.is_simple() || !src.is_memreg() || (size != DWORD && size != QWORD)) {
+			throw std::runtime_error {"Invalid operands"};
+		}
+
+		put_inst_sse_raw(0x66, 0xF6, src, dst.base.pack(), size, 0x38);
+
+	}
+
+	/// Add with Overflow Flag, only affects OF
+	void BufferWriter::put_adox(Location dst, Location src) {
+
+		const uint8_t size = pair_size(dst, src);
+
+		if (!dst.is_simple() || !src.is_memreg() || (size != DWORD && size != QWORD)) {
+			throw std::runtime_error {"Invalid operands"};
+		}
+
+		put_inst_sse_raw(0xF3, 0xF6, src, dst.base.pack(), size, 0x38);
+
+	}
+
+}
@@ -680,6 +680,14 @@ namespace asmio::x86 {
 			Label label = dst.label;
 			long addend = dst.offset;
 
+			// start short, the buffer will grow the jump later if needed
+			if (buffer.has_relaxation()) {
+				put_byte(0b11101011);
+				put_label(label, BYTE, addend);
+				buffer.add_relaxation(2, {0b11101001, 0, 0, 0, 0}, DWORD);
+				return;
+			}
+
 			if (buffer.has_label(label)) {
 
 				BufferMarker dst = buffer.get_label(label);
@@ -0,0 +1,776 @@
+#include "asm/x86/writer.hpp"
+
+namespace asmio::x86 {
+
+	/// Move Aligned Packed Single-Precision Floats
+	void BufferWriter::put_movaps(Location dst, Location src) {
+		put_inst_sse_mov(0, 0x28, 0x29, dst, src);
+	}
+
+	/// Move Unaligned Packed Single-Precision Floats
+	void BufferWriter::put_movups(Location dst, Location src) {
+		put_inst_sse_mov(0, 0x10, 0x11, dst, src);
+	}
+
+	/// Move Aligned Packed Double-Precision Floats
+	void BufferWriter::put_movapd(Location dst, Location src) {
+		put_inst_sse_mov(0x66, 0x28, 0x29, dst, src);
+	}
+
+	/// Move Unaligned Packed Double-Precision Floats
+	void BufferWriter::put_movupd(Location dst, Location src) {
+		put_inst_sse_mov(0x66, 0x10, 0x11, dst, src);
+	}
+
+	/// Move Aligned Packed Integers
+	void BufferWriter::put_movdqa(Location dst, Location src) {
+		put_inst_sse_mov(0x66, 0x6F, 0x7F, dst, src);
+	}
+
+	/// Move Unaligned Packed Integers
+	void BufferWriter::put_movdqu(Location dst, Location src) {
+		put_inst_sse_mov(0xF3, 0x6F, 0x7F, dst, src);
+	}
+
+	/// Move Scalar Single-Precision Float
+	void BufferWriter::put_movss(Location dst, Location src) {
+		put_inst_sse_mov(0xF3, 0x10, 0x11, dst, src);
+	}
+
+	/// Move Scalar Double-Precision Float
+	void BufferWriter::put_movsd(Location dst, Location src) {
+		put_inst_sse_mov(0xF2, 0x10, 0x11, dst, src);
+	}
+
+	/// Move Doubleword
+	void BufferWriter::put_movd(Location dst, Location src) {
+
+		if (dst.is_vector() && src.is_memreg() && (src.size == DWORD || src.size == VOID)) {
+			put_inst_sse_general(0x66, 0x6E, src, dst.base.pack(), DWORD);
+			return;
+		}
+
+		if (dst.is_memreg() && (dst.size == DWORD || dst.size == VOID) && src.is_vector()) {
+			put_inst_sse_general(0x66, 0x7E, dst, src.base.pack(), DWORD);
+			return;
+		}
+
+		throw std::runtime_error {"Invalid operands"};
+
+	}
+
+	/// Move Quadword
+	void BufferWriter::put_movq(Location dst, Location src) {
+
+		if (dst.is_vector() && src.is_simple() && src.size == QWORD) {
+			put_inst_sse_general(0x66, 0x6E, src, dst.base.pack(), QWORD);
+			return;
+		}
+
+		if (dst.is_simple() && dst.size == QWORD && src.is_vector()) {
+			put_inst_sse_general(0x66, 0x7E, dst, src.base.pack(), QWORD);
+			return;
+		}
+
+		if (dst.is_memory() && src.is_vector()) {
+			put_inst_sse_raw(0x66, 0xD6, dst, src.base.pack(), DWORD);
+			return;
+		}
+
+		put_inst_sse(0xF3, 0x7E, dst, src);
+
+	}
+
+	/// Extract Packed Single-Precision Float Sign Mask
+	void BufferWriter::put_movmskps(Location dst, Location src) {
+
+		if (!dst.is_simple() || !src.is_vector()) {
+			throw std::runtime_error {"Invalid operands"};
+		}
+
+		put_inst_sse_general(0, 0x50, src, dst.base.pack(), dst.size);
+
+	}
+
+	/// Extract Packed Double-Precision Float Sign Mask
+	void BufferWriter::put_movmskpd(Location dst, Location src) {
+
+		if (!dst.is_simple() || !src.is_vector()) {
+			throw std::runtime_error {"Invalid operands"};
+		}
+
+		put_inst_sse_general(0x66, 0x50, src, dst.base.pack(), dst.size);
+
+	}
+
+	/// Move Byte Mask
+	void BufferWriter::put_pmovmskb(Location dst, Location src) {
+
+		if (!dst.is_simple() || !src.is_vector()) {
+			throw std::runtime_error {"Invalid operands"};
+		}
+
+		put_inst_sse_general(0x66, 0xD7, src, dst.base.pack(), dst.size);
+
+	}
+
+	/// Add Packed Single-Precision Floats
+	void BufferWriter::put_addps(Location dst, Location src) {
+		put_inst_sse(0, 0x58, dst, src);
+	}
+
+	/// Add Packed Double-Precision Floats
+	void BufferWriter::put_addpd(Location dst, Location src) {
+		put_inst_sse(0x66, 0x58, dst, src);
+	}
+
+	/// Add Scalar Single-Precision Float
+	void BufferWriter::put_addss(Location dst, Location src) {
+		put_inst_sse(0xF3, 0x58, dst, src);
+	}
+
+	/// Add Scalar Double-Precision Float
+	void BufferWriter::put_addsd(Location dst, Location src) {
+		put_inst_sse(0xF2, 0x58, dst, src);
+	}
+
+	/// Subtract Packed Single-Precision Floats
+	void BufferWriter::put_subps(Location dst, Location src) {
+		put_inst_sse(0, 0x5C, dst, src);
+	}
+
+	/// Subtract Packed Double-Precision Floats
+	void BufferWriter::put_subpd(Location dst, Location src) {
+		put_inst_sse(0x66, 0x5C, dst, src);
+	}
+
+	/// Subtract Scalar Single-Precision Float
+	void BufferWriter::put_subss(Location dst, Location src) {
+		put_inst_sse(0xF3, 0x5C, dst, src);
+	}
+
+	/// Subtract Scalar Double-Precision Float
+	void BufferWriter::put_subsd(Location dst, Location src) {
+		put_inst_sse(0xF2, 0x5C, dst, src);
+	}
+
+	/// Multiply Packed Single-Precision Floats
+	void BufferWriter::put_mulps(Location dst, Location src) {
+		put_inst_sse(0, 0x59, dst, src);
+	}
+
+	/// Multiply Packed Double-Precision Floats
+	void BufferWriter::put_mulpd(Location dst, Location src) {
+		put_inst_sse(0x66, 0x59, dst, src);
+	}
+
+	/// Multiply Scalar Single-Precision Float
+	void BufferWriter::put_mulss(Location dst, Location src) {
+		put_inst_sse(0xF3, 0x59, dst, src);
+	}
+
+	/// Multiply Scalar Double-Precision Float
+	void BufferWriter::put_mulsd(Location dst, Location src) {
+		put_inst_sse(0xF2, 0x59, dst, src);
+	}
+
+	/// Divide Packed Single-Precision Floats
+	void BufferWriter::put_divps(Location dst, Location src) {
+		put_inst_sse(0, 0x5E, dst, src);
+	}
+
+	/// Divide Packed Double-Precision Floats
+	void BufferWriter::put_divpd(Location dst, Location src) {
+		put_inst_sse(0x66, 0x5E, dst, src);
+	}
+
+	/// Divide Scalar Single-Precision Float
+	void BufferWriter::put_divss(Location dst, Location src) {
+		put_inst_sse(0xF3, 0x5E, dst, src);
+	}
+
+	/// Divide Scalar Double-Precision Float
+	void BufferWriter::put_divsd(Location dst, Location src) {
+		put_inst_sse(0xF2, 0x5E, dst, src);
+	}
+
+	/// Minimum of Packed Single-Precision Floats
+	void BufferWriter::put_minps(Location dst, Location src) {
+		put_inst_sse(0, 0x5D, dst, src);
+	}
+
+	/// Minimum of Packed Double-Precision Floats
+	void BufferWriter::put_minpd(Location dst, Location src) {
+		put_inst_sse(0x66, 0x5D, dst, src);
+	}
+
+	/// Minimum of Scalar Single-Precision Float
+	void BufferWriter::put_minss(Location dst, Location src) {
+		put_inst_sse(0xF3, 0x5D, dst, src);
+	}
+
+	/// Minimum of Scalar Double-Precision Float
+	void BufferWriter::put_minsd(Location dst, Location src) {
+		put_inst_sse(0xF2, 0x5D, dst, src);
+	}
+
+	/// Maximum of Packed Single-Precision Floats
+	void BufferWriter::put_maxps(Location dst, Location src) {
+		put_inst_sse(0, 0x5F, dst, src);
+	}
+
+	/// Maximum of Packed Double-Precision Floats
+	void BufferWriter::put_maxpd(Location dst, Location src) {
+		put_inst_sse(0x66, 0x5F, dst, src);
+	}
+
+	/// Maximum of Scalar Single-Precision Float
+	void BufferWriter::put_maxss(Location dst, Location src) {
+		put_inst_sse(0xF3, 0x5F, dst, src);
+	}
+
+	/// Maximum of Scalar Double-Precision Float
+	void BufferWriter::put_maxsd(Location dst, Location src) {
+		put_inst_sse(0xF2, 0x5F, dst, src);
+	}
+
+	/// Square Root of Packed Single-Precision Floats
+	void BufferWriter::put_sqrtps(Location dst, Location src) {
+		put_inst_sse(0, 0x51, dst, src);
+	}
+
+	/// Square Root of Packed Double-Precision Floats
+	void BufferWriter::put_sqrtpd(Location dst, Location src) {
+		put_inst_sse(0x66, 0x51, dst, src);
+	}
+
+	/// Square Root of Scalar Single-Precision Float
+	void BufferWriter::put_sqrtss(Location dst, Location src) {
+		put_inst_sse(0xF3, 0x51, dst, src);
+	}
+
+	/// Square Root of Scalar Double-Precision Float
+	void BufferWriter::put_sqrtsd(Location dst, Location src) {
+		put_inst_sse(0xF2, 0x51, dst, src);
+	}
+
+	/// Bitwise AND of Packed Single-Precision Floats
+	void BufferWriter::put_andps(Location dst, Location src) {
+		put_inst_sse(0, 0x54, dst, src);
+	}
+
+	/// Bitwise AND of Packed Double-Precision Floats
+	void BufferWriter::put_andpd(Location dst, Location src) {
+		put_inst_sse(0x66, 0x54, dst, src);
+	}
+
+	/// Bitwise AND NOT of Packed Single-Precision Floats
+	void BufferWriter::put_andnps(Location dst, Location src) {
+		put_inst_sse(0, 0x55, dst, src);
+	}
+
+	/// Bitwise AND NOT of Packed Double-Precision Floats
+	void BufferWriter::put_andnpd(Location dst, Location src) {
+		put_inst_sse(0x66, 0x55, dst, src);
+	}
+
+	/// Bitwise OR of Packed Single-Precision Floats
+	void BufferWriter::put_orps(Location dst, Location src) {
+		put_inst_sse(0, 0x56, dst, src);
+	}
+
+	/// Bitwise OR of Packed Double-Precision Floats
+	void BufferWriter::put_orpd(Location dst, Location src) {
+		put_inst_sse(0x66, 0x56, dst, src);
+	}
+
+	/// Bitwise XOR of Packed Single-Precision Floats
+	void BufferWriter::put_xorps(Location dst, Location src) {
+		put_inst_sse(0, 0x57, dst, src);
+	}
+
+	/// Bitwise XOR of Packed Double-Precision Floats
+	void BufferWriter::put_xorpd(Location dst, Location src) {
+		put_inst_sse(0x66, 0x57, dst, src);
+	}
+
+	/// Compare Packed Single-Precision Floats, using the predicate given as immediate
+	void BufferWriter::put_cmpps(Location dst, Location src, Location imm) {
+		put_inst_sse_imm(0, 0xC2, dst, src, imm);
+	}
+
+	/// Compare Packed Double-Precision Floats, using the predicate given as immediate
+	void BufferWriter::put_cmppd(Location dst, Location src, Location imm) {
+		put_inst_sse_imm(0x66, 0xC2, dst, src, imm);
+	}
+
+	/// Compare Scalar Single-Precision Float, using the predicate given as immediate
+	void BufferWriter::put_cmpss(Location dst, Location src, Location imm) {
+		put_inst_sse_imm(0xF3, 0xC2, dst, src, imm);
+	}
+
+	/// Compare Scalar Double-Precision Float, using the predicate given as immediate
+	void BufferWriter::put_cmpsd(Location dst, Location src, Location imm) {
+		put_inst_sse_imm(0xF2, 0xC2, dst, src, imm);
+	}
+
+	/// Unordered Compare Scalar Single-Precision Floats and set EFLAGS
+	void BufferWriter::put_ucomiss(Location dst, Location src) {
+		put_inst_sse(0, 0x2E, dst, src);
+	}
+
+	/// Unordered Compare Scalar Double-Precision Floats and set EFLAGS
+	void BufferWriter::put_ucomisd(Location dst, Location src) {
+		put_inst_sse(0x66, 0x2E, dst, src);
+	}
+
+	/// Compare Scalar Single-Precision Floats and set EFLAGS
+	void BufferWriter::put_comiss(Location dst, Location src) {
+		put_inst_sse(0, 0x2F, dst, src);
+	}
+
+	/// Compare Scalar Double-Precision Floats and set EFLAGS
+	void BufferWriter::put_comisd(Location dst, Location src) {
+		put_inst_sse(0x66, 0x2F, dst, src);
+	}
+
+	/// Convert Integer to Scalar Single-Precision Float
+	void BufferWriter::put_cvtsi2ss(Location dst, Location src) {
+
+		if (!dst.is_vector() || !src.is_memreg()) {
+			throw std::runtime_error {"Invalid operands"};
+		}
+
+		put_inst_sse_general(0xF3, 0x2A, src, dst.base.pack(), src.size);
+
+	}
+
+	/// Convert Integer to Scalar Double-Precision Float
+	void BufferWriter::put_cvtsi2sd(Location dst, Location src) {
+
+		if (!dst.is_vector() || !src.is_memreg()) {
+			throw std::runtime_error {"Invalid operands"};
+		}
+
+		put_inst_sse_general(0xF2, 0x2A, src, dst.base.pack(), src.size);
+
+	}
+
+	/// Convert Scalar Single-Precision Float to Integer
+	void BufferWriter::put_cvtss2si(Location dst, Location src) {
+
+		if (!dst.is_simple() || !(src.is_vector() || src.is_memory())) {
+			throw std::runtime_error {"Invalid operands"};
+		}
+
+		put_inst_sse_general(0xF3, 0x2D, src, dst.base.pack(), dst.size);
+
+	}
+
+	/// Convert Scalar Double-Precision Float to Integer
+	void BufferWriter::put_cvtsd2si(Location dst, Location src) {
+
+		if (!dst.is_simple() || !(src.is_vector() || src.is_memory())) {
+			throw std::runtime_error {"Invalid operands"};
+		}
+
+		put_inst_sse_general(0xF2, 0x2D, src, dst.base.pack(), dst.size);
+
+	}
+
+	/// Convert with Truncation Scalar Single-Precision Float to Integer
+	void BufferWriter::put_cvttss2si(Location dst, Location src) {
+
+		if (!dst.is_simple() || !(src.is_vector() || src.is_memory())) {
+			throw std::runtime_error {"Invalid operands"};
+		}
+
+		put_inst_sse_general(0xF3, 0x2C, src, dst.base.pack(), dst.size);
+
+	}
+
+	/// Convert with Truncation Scalar Double-Precision Float to Integer
+	void BufferWriter::put_cvttsd2si(Location dst, Location src) {
+
+		if (!dst.is_simple() || !(src.is_vector() || src.is_memory())) {
+			throw std::runtime_error {"Invalid operands"};
+		}
+
+		put_inst_sse_general(0xF2, 0x2C, src, dst.base.pack(), dst.size);
+
+	}
+
+	/// Convert Scalar Single-Precision Float to Scalar Double-Precision Float
+	void BufferWriter::put_cvtss2sd(Location dst, Location src) {
+		put_inst_sse(0xF3, 0x5A, dst, src);
+	}
+
+	/// Convert Scalar Double-Precision Float to Scalar Single-Precision Float
+	void BufferWriter::put_cvtsd2ss(Location dst, Location src) {
+		put_inst_sse(0xF2, 0x5A, dst, src);
+	}
+
+	/// Convert Packed Single-Precision Floats to Packed Double-Precision Floats
+	void BufferWriter::put_cvtps2pd(Location dst, Location src) {
+		put_inst_sse(0, 0x5A, dst, src);
+	}
+
+	/// Convert Packed Double-Precision Floats to Packed Single-Precision Floats
+	void BufferWriter::put_cvtpd2ps(Location dst, Location src) {
+		put_inst_sse(0x66, 0x5A, dst, src);
+	}
+
+	/// Convert Packed Doubleword Integers to Packed Single-Precision Floats
+	void BufferWriter::put_cvtdq2ps(Location dst, Location src) {
+		put_inst_sse(0, 0x5B, dst, src);
+	}
+
+	/// Convert Packed Single-Precision Floats to Packed Doubleword Integers
+	void BufferWriter::put_cvtps2dq(Location dst, Location src) {
+		put_inst_sse(0x66, 0x5B, dst, src);
+	}
+
+	/// Convert with Truncation Packed Single-Precision Floats to Packed Doubleword Integers
+	void BufferWriter::put_cvttps2dq(Location dst, Location src) {
+		put_inst_sse(0xF3, 0x5B, dst, src);
+	}
+
+	/// Add Packed Byte Integers
+	void BufferWriter::put_paddb(Location dst, Location src) {
+		put_inst_sse(0x66, 0xFC, dst, src);
+	}
+
+	/// Add Packed Word Integers
+	void BufferWriter::put_paddw(Location dst, Location src) {
+		put_inst_sse(0x66, 0xFD, dst, src);
+	}
+
+	/// Add Packed Doubleword Integers
+	void BufferWriter::put_paddd(Location dst, Location src) {
+		put_inst_sse(0x66, 0xFE, dst, src);
+	}
+
+	/// Add Packed Quadword Integers
+	void BufferWriter::put_paddq(Location dst, Location src) {
+		put_inst_sse(0x66, 0xD4, dst, src);
+	}
+
+	/// Subtract Packed Byte Integers
+	void BufferWriter::put_psubb(Location dst, Location src) {
+		put_inst_sse(0x66, 0xF8, dst, src);
+	}
+
+	/// Subtract Packed Word Integers
+	void BufferWriter::put_psubw(Location dst, Location src) {
+		put_inst_sse(0x66, 0xF9, dst, src);
+	}
+
+	/// Subtract Packed Doubleword Integers
+	void BufferWriter::put_psubd(Location dst, Location src) {
+		put_inst_sse(0x66, 0xFA, dst, src);
+	}
+
+	/// Subtract Packed Quadword Integers
+	void BufferWriter::put_psubq(Location dst, Location src) {
+		put_inst_sse(0x66, 0xFB, dst, src);
+	}
+
+	/// Multiply Packed Word Integers and Store Low Result
+	void BufferWriter::put_pmullw(Location dst, Location src) {
+		put_inst_sse(0x66, 0xD5, dst, src);
+	}
+
+	/// Multiply Packed Doubleword Integers and Store Low Result
+	void BufferWriter::put_pmulld(Location dst, Location src) {
+		put_inst_sse(0x66, 0x40, dst, src, 0x38);
+	}
+
+	/// Multiply Packed Unsigned Doubleword Integers into Quadwords
+	void BufferWriter::put_pmuludq(Location dst, Location src) {
+		put_inst_sse(0x66, 0xF4, dst, src);
+	}
+
+	/// Bitwise AND
+	void BufferWriter::put_pand(Location dst, Location src) {
+		put_inst_sse(0x66, 0xDB, dst, src);
+	}
+
+	/// Bitwise AND NOT
+	void BufferWriter::put_pandn(Location dst, Location src) {
+		put_inst_sse(0x66, 0xDF, dst, src);
+	}
+
+	/// Bitwise OR
+	void BufferWriter::put_por(Location dst, Location src) {
+		put_inst_sse(0x66, 0xEB, dst, src);
+	}
+
+	/// Bitwise XOR
+	void BufferWriter::put_pxor(Location dst, Location src) {
+		put_inst_sse(0x66, 0xEF, dst, src);
+	}
+
+	/// Compare Packed Bytes for Equal
+	void BufferWriter::put_pcmpeqb(Location dst, Location src) {
+		put_inst_sse(0x66, 0x74, dst, src);
+	}
+
+	/// Compare Packed Words for Equal
+	void BufferWriter::put_pcmpeqw(Location dst, Location src) {
+		put_inst_sse(0x66, 0x75, dst, src);
+	}
+
+	/// Compare Packed Doublewords for Equal
+	void BufferWriter::put_pcmpeqd(Location dst, Location src) {
+		put_inst_sse(0x66, 0x76, dst, src);
+	}
+
+	/// Compare Packed Quadwords for Equal
+	void BufferWriter::put_pcmpeqq(Location dst, Location src) {
+		put_inst_sse(0x66, 0x29, dst, src, 0x38);
+	}
+
+	/// Compare Packed Signed Bytes for Greater Than
+	void BufferWriter::put_pcmpgtb(Location dst, Location src) {
+		put_inst_sse(0x66, 0x64, dst, src);
+	}
+
+	/// Compare Packed Signed Words for Greater Than
+	void BufferWriter::put_pcmpgtw(Location dst, Location src) {
+		put_inst_sse(0x66, 0x65, dst, src);
+	}
+
+	/// Compare Packed Signed Doublewords for Greater Than
+	void BufferWriter::put_pcmpgtd(Location dst, Location src) {
+		put_inst_sse(0x66, 0x66, dst, src);
+	}
+
+	/// Compare Packed Signed Quadwords for Greater Than
+	void BufferWriter::put_pcmpgtq(Location dst, Location src) {
+		put_inst_sse(0x66, 0x37, dst, src, 0x38);
+	}
+
+	/// Minimum of Packed Unsigned Bytes
+	void BufferWriter::put_pminub(Location dst, Location src) {
+		put_inst_sse(0x66, 0xDA, dst, src);
+	}
+
+	/// Maximum of Packed Unsigned Bytes
+	void BufferWriter::put_pmaxub(Location dst, Location src) {
+		put_inst_sse(0x66, 0xDE, dst, src);
+	}
+
+	/// Minimum of Packed Signed Doublewords
+	void BufferWriter::put_pminsd(Location dst, Location src) {
+		put_inst_sse(0x66, 0x39, dst, src, 0x38);
+	}
+
+	/// Maximum of Packed Signed Doublewords
+	void BufferWriter::put_pmaxsd(Location dst, Location src) {
+		put_inst_sse(0x66, 0x3D, dst, src, 0x38);
+	}
+
+	/// Minimum of Packed Unsigned Doublewords
+	void BufferWriter::put_pminud(Location dst, Location src) {
+		put_inst_sse(0x66, 0x3B, dst, src, 0x38);
+	}
+
+	/// Maximum of Packed Unsigned Doublewords
+	void BufferWriter::put_pmaxud(Location dst, Location src) {
+		put_inst_sse(0x66, 0x3F, dst, src, 0x38);
+	}
+
+	/// Unpack and Interleave Low-Order Bytes
+	void BufferWriter::put_punpcklbw(Location dst, Location src) {
+		put_inst_sse(0x66, 0x60, dst, src);
+	}
+
+	/// Unpack and Interleave Low-Order Words
+	void BufferWriter::put_punpcklwd(Location dst, Location src) {
+		put_inst_sse(0x66, 0x61, dst, src);
+	}
+
+	/// Unpack and Interleave Low-Order Doublewords
+	void BufferWriter::put_punpckldq(Location dst, Location src) {
+		put_inst_sse(0x66, 0x62, dst, src);
+	}
+
+	/// Unpack and Interleave Low-Order Quadwords
+	void BufferWriter::put_punpcklqdq(Location dst, Location src) {
+		put_inst_sse(0x66, 0x6C, dst, src);
+	}
+
+	/// Unpack and Interleave High-Order Bytes
+	void BufferWriter::put_punpckhbw(Location dst, Location src) {
+		put_inst_sse(0x66, 0x68, dst, src);
+	}
+
+	/// Unpack and Interleave High-Order Words
+	void BufferWriter::put_punpckhwd(Location dst, Location src) {
+		put_inst_sse(0x66, 0x69, dst, src);
+	}
+
+	/// Unpack and Interleave High-Order Doublewords
+	void BufferWriter::put_punpckhdq(Location dst, Location src) {
+		put_inst_sse(0x66, 0x6A, dst, src);
+	}
+
+	/// Unpack and Interleave High-Order Quadwords
+	void BufferWriter::put_punpckhqdq(Location dst, Location src) {
+		put_inst_sse(0x66, 0x6D, dst, src);
+	}
+
+	/// Pack Words into Bytes with Signed Saturation
+	void BufferWriter::put_packsswb(Location dst, Location src) {
+		put_inst_sse(0x66, 0x63, dst, src);
+	}
+
+	/// Pack Doublewords into Words with Signed Saturation
+	void BufferWriter::put_packssdw(Location dst, Location src) {
+		put_inst_sse(0x66, 0x6B, dst, src);
+	}
+
+	/// Pack Words into Bytes with Unsigned Saturation
+	void BufferWriter::put_packuswb(Location dst, Location src) {
+		put_inst_sse(0x66, 0x67, dst, src);
+	}
+
+	/// Shuffle Packed Bytes
+	void BufferWriter::put_pshufb(Location dst, Location src) {
+		put_inst_sse(0x66, 0x00, dst, src, 0x38);
+	}
+
+	/// Logical Compare and set ZF and CF
+	void BufferWriter::put_ptest(Location dst, Location src) {
+		put_inst_sse(0x66, 0x17, dst, src, 0x38);
+	}
+
+	/// Shuffle Packed Doublewords
+	void BufferWriter::put_pshufd(Location dst, Location src, Location imm) {
+		put_inst_sse_imm(0x66, 0x70, dst, src, imm);
+	}
+
+	/// Shuffle Packed Low Words
+	void BufferWriter::put_pshuflw(Location dst, Location src, Location imm) {
+		put_inst_sse_imm(0xF2, 0x70, dst, src, imm);
+	}
+
+	/// Shuffle Packed High Words
+	void BufferWriter::put_pshufhw(Location dst, Location src, Location imm) {
+		put_inst_sse_imm(0xF3, 0x70, dst, src, imm);
+	}
+
+	/// Shuffle Packed Single-Precision Floats
+	void BufferWriter::put_shufps(Location dst, Location src, Location imm) {
+		put_inst_sse_imm(0, 0xC6, dst, src, imm);
+	}
+
+	/// Shuffle Packed Double-Precision Floats
+	void BufferWriter::put_shufpd(Location dst, Location src, Location imm) {
+		put_inst_sse_imm(0x66, 0xC6, dst, src, imm);
+	}
+
+	/// Packed Align Right
+	void BufferWriter::put_palignr(Location dst, Location src, Location imm) {
+		put_inst_sse_imm(0x66, 0x0F, dst, src, imm, 0x3A);
+	}
+
+	/// Shift Packed Words Left Logical
+	void BufferWriter::put_psllw(Location dst, Location src) {
+		put_inst_sse_shift(0xF1, 0x71, 0b110, dst, src);
+	}
+
+	/// Shift Packed Doublewords Left Logical
+	void BufferWriter::put_pslld(Location dst, Location src) {
+		put_inst_sse_shift(0xF2, 0x72, 0b110, dst, src);
+	}
+
+	/// Shift Packed Quadwords Left Logical
+	void BufferWriter::put_psllq(Location dst, Location src) {
+		put_inst_sse_shift(0xF3, 0x73, 0b110, dst, src);
+	}
+
+	/// Shift Packed Words Right Logical
+	void BufferWriter::put_psrlw(Location dst, Location src) {
+		put_inst_sse_shift(0xD1, 0x71, 0b010, dst, src);
+	}
+
+	/// Shift Packed Doublewords Right Logical
+	void BufferWriter::put_psrld(Location dst, Location src) {
+		put_inst_sse_shift(0xD2, 0x72, 0b010, dst, src);
+	}
+
+	/// Shift Packed Quadwords Right Logical
+	void BufferWriter::put_psrlq(Location dst, Location src) {
+		put_inst_sse_shift(0xD3, 0x73, 0b010, dst, src);
+	}
+
+	/// Shift Packed Words Right Arithmetic
+	void BufferWriter::put_psraw(Location dst, Location src) {
+		put_inst_sse_shift(0xE1, 0x71, 0b100, dst, src);
+	}
+
+	/// Shift Packed Doublewords Right Arithmetic
+	void BufferWriter::put_psrad(Location dst, Location src) {
+		put_inst_sse_shift(0xE2, 0x72, 0b100, dst, src);
+	}
+
+	/// Shift Double Quadword Left Logical, by bytes
+	void BufferWriter::put_pslldq(Location dst, Location src) {
+		put_inst_sse_shift(0, 0x73, 0b111, dst, src);
+	}
+
+	/// Shift Double Quadword Right Logical, by bytes
+	void BufferWriter::put_psrldq(Location dst, Location src) {
+		put_inst_sse_shift(0, 0x73, 0b011, dst, src);
+	}
+
+	/// Extract Byte
+	void BufferWriter::put_pextrb(Location dst, Location src, Location imm) {
+		put_inst_sse_extract(0x3A, 0x14, BYTE, dst, src, imm);
+	}
+
+	/// Extract Word
+	void BufferWriter::put_pextrw(Location dst, Location src, Location imm) {
+
+		// the SSE4.1 form is only needed for the memory destination, SSE2 already has one for registers
+		if (dst.is_simple() && dst.size == DWORD && src.is_vector() && imm.is_immediate()) {
+			put_inst_sse_raw(0x66, 0xC5, src, dst.base.pack(), DWORD);
+			put_byte(imm.offset);
+			return;
+		}
+
+		put_inst_sse_extract(0x3A, 0x15, WORD, dst, src, imm);
+	}
+
+	/// Extract Doubleword
+	void BufferWriter::put_pextrd(Location dst, Location src, Location imm) {
+		put_inst_sse_extract(0x3A, 0x16, DWORD, dst, src, imm);
+	}
+
+	/// Extract Quadword
+	void BufferWriter::put_pextrq(Location dst, Location src, Location imm) {
+		put_inst_sse_extract(0x3A, 0x16, QWORD, dst, src, imm);
+	}
+
+	/// Insert Byte
+	void BufferWriter::put_pinsrb(Location dst, Location src, Location imm) {
+		put_inst_sse_insert(0x3A, 0x20, BYTE, dst, src, imm);
+	}
+
+	/// Insert Word
+	void BufferWriter::put_pinsrw(Location dst, Location src, Location imm) {
+		put_inst_sse_insert(0, 0xC4, WORD, dst, src, imm);
+	}
+
+	/// Insert Doubleword
+	void BufferWriter::put_pinsrd(Location dst, Location src, Location imm) {
+		put_inst_sse_insert(0x3A, 0x22, DWORD, dst, src, imm);
+	}
+
+	/// Insert Quadword
+	void BufferWriter::put_pinsrq(Location dst, Location src, Location imm) {
+		put_inst_sse_insert(0x3A, 0x22, QWORD, dst, src, imm);
+	}
+
+}
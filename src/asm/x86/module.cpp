@@ -7,104 +7,37 @@ namespace asmio::x86 {
 
 	using namespace tasml;
 
+	static constexpr auto sizing_names = util::name_table<int>({
+		{"byte", BYTE},
+		{"word", WORD},
+		{"dword", DWORD},
+		{"qword", QWORD},
+		{"tword", TWORD},
+		{"xword", XWORD},
+		{"yword", YWORD},
+		{"zword", ZWORD},
+
+		{"float", DWORD},
+		{"double", QWORD},
+		{"real", TWORD},
+	});
+
 	static int token_to_sizing(const Token* token) {
 		if (token == nullptr || token->type != Token::NAME) return -1;
-		std::string raw = util::to_lower(token->raw);
-
-		static std::unordered_map<std::string, int> types = {
-			{"byte", BYTE},
-			{"word", WORD},
-			{"dword", DWORD},
-			{"qword", QWORD},
-			{"tword", TWORD},
-
-			{"float", DWORD},
-			{"double", QWORD},
-			{"real", TWORD},
-		};
 
-		auto it = types.find(raw);
-
-		if (it == types.end()) {
-			return -1;
+		if (const int* size = sizing_names.find(token->raw)) {
+			return *size;
 		}
 
-		return it->second;
+		return -1;
 	}
 
 	static Registry token_to_register(const Token* token) {
 		if (token == nullptr || token->type != Token::NAME) return UNSET;
-		std::string raw = util::to_lower(token->raw);
-
-		if (raw == "eax") return EAX;
-		if (raw == "ax") return AX;
-		if (raw == "al") return AL;
-		if (raw == "ah") return AH;
-		if (raw == "ebx") return EBX;
-		if (raw == "bx") return BX;
-		if (raw == "bl") return BL;
-		if (raw == "bh") return BH;
-		if (raw == "ecx") return ECX;
-		if (raw == "cx") return CX;
-		if (raw == "cl") return CL;
-		if (raw == "ch") return CH;
-		if (raw == "edx") return EDX;
-		if (raw == "dx") return DX;
-		if (raw == "dl") return DL;
-		if (raw == "dh") return DH;
-		if (raw == "esi") return ESI;
-		if (raw == "si") return SI;
-		if (raw == "edi") return EDI;
-		if (raw == "di") return DI;
-		if (raw == "ebp") return EBP;
-		if (raw == "bp") return BP;
-		if (raw == "esp") return ESP;
-		if (raw == "sp") return SP;
-		if (raw == "st") return ST;
-		if (raw == "spl") return SPL;
-		if (raw == "bpl") return BPL;
-		if (raw == "sil") return SIL;
-		if (raw == "dil") return DIL;
-		if (raw == "rax") return RAX;
-		if (raw == "rbx") return RBX;
-		if (raw == "rcx") return RCX;
-		if (raw == "rdx") return RDX;
-		if (raw == "rsi") return RSI;
-		if (raw == "rdi") return RDI;
-		if (raw == "rbp") return RBP;
-		if (raw == "rsp") return RSP;
-		if (raw == "r8l") return R8L;
-		if (raw == "r8w") return R8W;
-		if (raw == "r8d") return R8D;
-		if (raw == "r8") return R8;
-		if (raw == "r9l") return R9L;
-		if (raw == "r9w") return R9W;
-		if (raw == "r9d") return R9D;
-		if (raw == "r9") return R9;
-		if (raw == "r10l") return R10L;
-		if (raw == "r10w") return R10W;
-		if (raw == "r10d") return R10D;
-		if (raw == "r10") return R10;
-		if (raw == "r11l") return R11L;
-		if (raw == "r11w") return R11W;
-		if (raw == "r11d") return R11D;
-		if (raw == "r11") return R11;
-		if (raw == "r12l") return R12L;
-		if (raw == "r12w") return R12W;
-		if (raw == "r12d") return R12D;
-		if (raw == "r12") return R12;
-		if (raw == "r31l") return R13L;
-		if (raw == "r13w") return R13W;
-		if (raw == "r13d") return R13D;
-		if (raw == "r13") return R13;
-		if (raw == "r14l") return R14L;
-		if (raw == "r14w") return R14W;
-		if (raw == "r14d") return R14D;
-		if (raw == "r14") return R14;
-		if (raw == "r15l") return R15L;
-		if (raw == "r15w") return R15W;
-		if (raw == "r15d") return R15D;
-		if (raw == "r15") return R15;
+
+		if (const Registry* registry = REGISTRY_NAMES.find(token->raw)) {
+			return *registry;
+		}
 
 		throw std::runtime_error {"Unknown registry " + token->quoted()};
 	}
@@ -236,7 +169,7 @@ namespace asmio::x86 {
 		// nothing should be left in the stream
 		stream.assert_empty();
 
-		const char* name = (label == nullptr) ? nullptr : label->raw.c_str() + 1 /* skip the '@' */;
+		const Label name = (label == nullptr) ? Label {} : Label {label->as_label()};
 		const uint32_t scale_value = (scale == nullptr) ? 0 : scale->as_int();
 
 		return token_to_register(base) + token_to_register(index) * scale_value + offset + name;
@@ -250,16 +183,53 @@ namespace asmio::x86 {
 		return parse_expression(stream);
 	}
 
-	static Location parse_location(TokenStream stream) {
+	static Location parse_cast(TokenStream stream) {
 		const Token* name = &stream.peek();
 		const int size = token_to_sizing(name);
 
 		if (size != -1) {
 			stream.next(); // consume 'name' token if it was a cast
-			return parse_inner(stream).cast(size);
 		}
 
-		return parse_inner(stream);
+		// AVX-512 embedded broadcast, uses the same syntax as GAS (e.g. 'dword bcst [rax]')
+		if (stream.accept("bcst")) {
+			const Location location = parse_inner(stream).broadcasted();
+			return (size != -1) ? location.cast(size) : location;
+		}
+
+		const Location location = parse_inner(stream);
+		return (size != -1) ? location.cast(size) : location;
+	}
+
+	static Location parse_location(TokenStream stream) {
+		const Location location = parse_cast(stream.until("{", "operand"));
+		const Token* opmask = nullptr;
+		bool zeroing = false;
+
+		// AVX-512 decorators follow the operand (e.g. 'zmm1 {k1} {z}')
+		while (stream.accept("{")) {
+			TokenStream decorator = stream.block("{}", "decorator");
+
+			if (decorator.accept("z")) {
+				zeroing = true;
+			} else {
+				opmask = &decorator.next();
+			}
+
+			decorator.assert_empty();
+		}
+
+		stream.assert_empty();
+
+		if (opmask != nullptr) {
+			return location.masked(token_to_register(opmask), zeroing);
+		}
+
+		if (zeroing) {
+			throw std::runtime_error {"Zero masking requires an opmask register"};
+		}
+
+		return location;
 	}
 
 	template <typename T>
@@ -296,4 +266,8 @@ namespace asmio::x86 {
 		return ElfMachine::X86_64;
 	}
 
+	Padding::Filler LanguageModule::filler() const {
+		return BufferWriter::put_nops;
+	}
+
 }
@@ -10,6 +10,7 @@ namespace asmio::x86 {
 		FeatureSet features() const override;
 		void parse(tasml::ErrorHandler& reporter, tasml::TokenStream stream, SegmentedBuffer& buffer) const override;
 		ElfMachine machine() const override;
+		Padding::Filler filler() const override;
 
 	};
 
@@ -28,6 +28,118 @@ namespace asmio::x86 {
 
 	}
 
+	/// The 'pp' field of the (E)VEX prefix replaces the mandatory SSE prefix
+	static uint8_t get_vex_pp(uint8_t prefix) {
+		return prefix == 0x66 ? 0b01 : prefix == 0xF3 ? 0b10 : prefix == 0xF2 ? 0b11 : 0b00;
+	}
+
+	void BufferWriter::put_inst_vex(const VexPrefix& vex, bool w, bool r, bool x, bool b, uint8_t map) {
+
+		const uint8_t pp = get_vex_pp(vex.prefix);
+
+		// R, X, B and vvvv are all stored inverted
+		const uint8_t rvvvvlpp = (~vex.vvvv & 0b1111) << 3 | (vex.l ? 0b100 : 0) | pp;
+
+		//   7   6 5 4 3   2   1 0
+		// + - + ------- + - + --- +
+		// | R | vvvv    | L | pp  |
+		// + - + ------- + - + --- +
+		//   |   |         |   |
+		//   |   |         |   \_ implied prefix (none, 66, F3, F2)
+		//   |   |         \_ vector length (128, 256)
+		//   |   \_ additional register operand
+		//   \_ inverted REX.R
+
+		// the short form can only be used when the omitted fields have their default value
+		if (!w && !x && !b && map == 0b00001) {
+			put_byte(VEX_SHORT);
+			put_byte((r ? 0 : 0b1000'0000) | rvvvvlpp);
+			return;
+		}
+
+		//   7   6   5   4 3 2 1 0     7   6 5 4 3   2   1 0
+		// + - + - + - + --------- + + - + ------- + - + --- +
+		// | R | X | B | mmmmm     | | W | vvvv    | L | pp  |
+		// + - + - + - + --------- + + - + ------- + - + --- +
+		//   |   |   |   |           |
+		//   |   |   |   |           \_ REX.W, or an opcode extension
+		//   |   |   |   \_ opcode map (0F, 0F38, 0F3A)
+		//   \___\___\_ inverted REX.R, REX.X, REX.B
+
+		put_byte(VEX_LONG);
+		put_byte((r ? 0 : 0b1000'0000) | (x ? 0 : 0b0100'0000) | (b ? 0 : 0b0010'0000) | map);
+		put_byte((w ? 0b1000'0000 : 0) | rvvvvlpp);
+
+	}
+
+	void BufferWriter::put_inst_evex(const VexPrefix& vex, bool w, uint8_t reg, bool x, bool b, uint8_t map) {
+
+		//   7   6   5   4    3 2   1 0
+		// + - + - + - + -- + --- + --- +
+		// | R | X | B | R' | 0 0 | mm  |
+		// + - + - + - + -- + --- + --- +
+		//   |   |   |   |          |
+		//   |   |   |   |          \_ opcode map (0F, 0F38, 0F3A)
+		//   |   |   |   \_ inverted bit 5 of MODRM.reg
+		//   \___\___\_ inverted REX.R, REX.X, REX.B
+
+		put_byte(EVEX);
+		put_byte((reg & REG_HIGH ? 0 : 0b1000'0000) | (x ? 0 : 0b0100'0000) | (b ? 0 : 0b0010'0000) | (reg & REG_EVEX ? 0 : 0b0001'0000) | map);
+
+		//   7   6 5 4 3   2   1 0
+		// + - + ------- + - + --- +
+		// | W | vvvv    | 1 | pp  |
+		// + - + ------- + - + --- +
+
+		put_byte((w ? 0b1000'0000 : 0) | (~vex.vvvv & 0b1111) << 3 | 0b100 | get_vex_pp(vex.prefix));
+
+		//   7   6 5   4   3    2 1 0
+		// + - + --- + - + -- + ----- +
+		// | z | L'L | b | V' | aaa   |
+		// + - + --- + - + -- + ----- +
+		//   |   |     |   |    |
+		//   |   |     |   |    \_ opmask register, K0 means no masking
+		//   |   |     |   \_ inverted bit 5 of vvvv
+		//   |   |     \_ embedded broadcast
+		//   |   \_ vector length (128, 256, 512)
+		//   \_ zero masking
+
+		const Decorator& decorator = vex.decorator;
+		put_byte((decorator.zeroing ? 0b1000'0000 : 0) | vex.l << 5 | (decorator.broadcast ? 0b1'0000 : 0) | (vex.vvvv & REG_EVEX ? 0 : 0b1000) | decorator.mask);
+
+	}
+
+	void BufferWriter::put_inst_opcode_prefix(const VexPrefix& vex, bool rex, bool w, uint8_t reg, bool x, bool b, bool longer, uint8_t escape) {
+
+		// the (E)VEX prefix encodes both the REX bits and the opcode escape bytes
+		if (vex.enabled) {
+			const uint8_t map = escape == 0x38 ? 0b00010 : escape == 0x3A ? 0b00011 : 0b00001;
+
+			if (vex.evex) {
+				put_inst_evex(vex, w, reg, x, b, map);
+				return;
+			}
+
+			put_inst_vex(vex, w, reg & REG_HIGH, x, b, map);
+			return;
+		}
+
+		if (rex) {
+			put_inst_rex(w, reg & REG_HIGH, x, b);
+		}
+
+		// two byte opcode, starts with 0x0F
+		if (longer) {
+			put_byte(LONG_OPCODE);
+		}
+
+		// three byte opcode, starts with 0x0F 0x38 or 0x0F 0x3A
+		if (escape) {
+			put_byte(escape);
+		}
+
+	}
+
 	uint8_t BufferWriter::pack_opcode_dw(uint8_t opcode, bool d, bool w) {
 
 		//   7 6 5 4 3 2   1   0
@@ -105,23 +217,7 @@ namespace asmio::x86 {
 			width = QWORD;
 		}
 
-		buffer.add_linkage(label, shift, [width, type, addend] (SegmentedBuffer* buffer, const Linkage& linkage, size_t mount) {
-			BufferMarker src = buffer->get_label(linkage.label);
-			BufferMarker dst = linkage.target;
-
-			const int64_t offset = (type == RELATIVE)
-				? buffer->get_offset(dst)
-				: -mount;
-
-			const int64_t value = buffer->get_offset(src) - offset + addend;
-
-			if (util::min_sign_extended_bytes(value) > width) {
-				throw std::runtime_error {"Can't fit label '" + linkage.label.string() + "' (" + util::to_hex(value) + ") into target of size " + std::to_string(width) + ", some data would have been truncated!"};
-			}
-
-			const uint8_t* value_ptr = reinterpret_cast<const uint8_t*>(&value);
-			memcpy(buffer->get_pointer(dst), value_ptr, width);
-		});
+		buffer.add_linkage(label, shift, (type == RELATIVE) ? Linkage::RELATIVE : Linkage::ABSOLUTE, width, addend);
 	}
 
 	void BufferWriter::put_inst_label_imm(Location imm, uint8_t width) {
@@ -138,15 +234,23 @@ namespace asmio::x86 {
 		put_inst_imm(imm.offset, width);
 	}
 
-	void BufferWriter::put_inst_std(uint8_t opcode, const Location& dst, RegInfo packed, uint8_t size, bool longer) {
+	void BufferWriter::put_inst_std(uint8_t opcode, const Location& dst, RegInfo packed, uint8_t size, bool longer, uint8_t escape) {
 
 		// always query suffix size to clear it when not used
 		const int suffix_bytes = get_suffix();
 
+		// same with the VEX prefix
+		const VexPrefix vex = std::exchange(this->vex, {});
+
 		if (size == VOID) {
 			throw std::runtime_error {"Unable to deduce operand size"};
 		}
 
+		// registers 16-31 only exist in the AVX-512 instructions
+		if (!vex.evex && ((packed.reg | dst.base.reg | dst.index.reg) & REG_EVEX)) {
+			throw std::runtime_error {"Invalid operands, registers 16-31 require an AVX-512 instruction"};
+		}
+
 		// this assumes that both operands have the same size
 		if (size == WORD) {
 			put_16bit_operand_prefix();
@@ -161,7 +265,8 @@ namespace asmio::x86 {
 				adr_size = dst.base.size;
 			}
 
-			if (dst.index != UNSET) {
+			// vector index (VSIB) has no effect on the address size
+			if (dst.is_indexed()) {
 
 				// check if the size is correct
 				// we can use [eax + edx] and [rax + rdx] but not [eax + rdx]
@@ -186,16 +291,11 @@ namespace asmio::x86 {
 		}
 
 		// simple registry to registry operation
-		if (dst.is_simple()) {
+		if (dst.is_simple() || dst.is_vector() || dst.is_opmask()) {
 
-			if (packed.rex || dst.base.is(Registry::REX) || size == QWORD) {
-				put_inst_rex(size == QWORD, packed.is_extended(), false, dst.base.reg & 0b1000);
-			}
-
-			// two byte opcode, starts with 0x0F
-			if (longer) {
-				put_byte(LONG_OPCODE);
-			}
+			// with EVEX the X bit extends the register in MODRM.rm instead of the SIB index
+			const bool rex = packed.rex || dst.base.is(Registry::REX) || size == QWORD;
+			put_inst_opcode_prefix(vex, rex, size == QWORD, packed.reg, dst.base.reg & REG_EVEX, dst.base.reg & 0b1000, longer, escape);
 
 			put_byte(opcode);
 			put_inst_mod_reg_rm(MOD_SHORT, packed.reg, dst.base.low());
@@ -206,7 +306,7 @@ namespace asmio::x86 {
 		uint8_t sib_scale = dst.get_ss_flag();
 		uint8_t sib_index = dst.index.reg;
 		uint8_t sib_base = dst.base.reg;
-		uint8_t mrm_mod = dst.get_mod_flag();
+		uint8_t mrm_mod = dst.get_mod_flag(vex.disp_scale);
 		uint8_t mrm_mem = dst.base.reg;
 		uint8_t imm_len = DWORD;
 		bool rip_relative = false;
@@ -250,7 +350,7 @@ namespace asmio::x86 {
 		}
 
 		// we have to use the SIB byte to target ESP/RSP
-		else if (dst.base.is_esp_like() || dst.is_indexed()) {
+		else if (dst.base.is_esp_like() || dst.is_indexed() || dst.is_vector_indexed()) {
 			mrm_mem = RM_SIB;
 
 			// special case for [EBP/RBP/R13 + (indexed)]
@@ -279,14 +379,8 @@ namespace asmio::x86 {
 		}
 
 		// REX
-		if (size == QWORD || packed.rex || (sib_index & REG_HIGH) || (sib_base & REG_HIGH)) {
-			put_inst_rex(size == QWORD, packed.is_extended(), sib_index & REG_HIGH, (mrm_mem | sib_base) & REG_HIGH);
-		}
-
-		// two byte opcode, starts with 0x0F
-		if (longer) {
-			put_byte(LONG_OPCODE);
-		}
+		const bool rex = size == QWORD || packed.rex || (sib_index & REG_HIGH) || (sib_base & REG_HIGH);
+		put_inst_opcode_prefix(vex, rex, size == QWORD, packed.reg, sib_index & REG_HIGH, (mrm_mem | sib_base) & REG_HIGH, longer, escape);
 
 		put_byte(opcode);
 		put_inst_mod_reg_rm(mrm_mod, packed.low(), mrm_mem & REG_LOW);
@@ -305,6 +399,12 @@ namespace asmio::x86 {
 				return;
 			}
 
+			// the compressed displacement (disp8*N) is stored divided by the operand size
+			if (imm_len == BYTE && vex.disp_scale != 1) {
+				put_inst_imm(dst.offset / vex.disp_scale, BYTE);
+				return;
+			}
+
 			// otherwise just put the immediate as-is
 			put_inst_label_imm(dst, imm_len);
 		}
@@ -493,6 +593,14 @@ namespace asmio::x86 {
 			throw std::runtime_error {"Invalid operand"};
 		}
 
+		// start short, the buffer will grow the jump later if needed
+		if (buffer.has_relaxation()) {
+			put_byte(sopcode);
+			put_label(label, BYTE, addend);
+			buffer.add_relaxation(2, {0b00001111, lopcode, 0, 0, 0, 0}, DWORD);
+			return;
+		}
+
 		if (buffer.has_label(label)) {
 
 			BufferMarker dst = buffer.get_label(label);
@@ -525,6 +633,513 @@ namespace asmio::x86 {
 		put_inst_std_as(0b1001'0000 | lopcode, dst, RegInfo::raw(0), true);
 	}
 
+	/**
+	 * Used for constructing the SSE instructions, the operation is always 'dst = dst op src'
+	 */
+	void BufferWriter::put_inst_sse(uint8_t prefix, uint8_t opcode, const Location& dst, const Location& src, uint8_t escape) {
+
+		if (!dst.is_vector() || !(src.is_vector() || src.is_memory())) {
+			throw std::runtime_error {"Invalid operands"};
+		}
+
+		put_inst_sse_raw(prefix, opcode, src, dst.base.pack(), DWORD, escape);
+
+	}
+
+	/**
+	 * Used for constructing the SSE instructions that take an additional byte immediate
+	 */
+	void BufferWriter::put_inst_sse_imm(uint8_t prefix, uint8_t opcode, const Location& dst, const Location& src, const Location& imm, uint8_t escape) {
+
+		if (!imm.is_immediate()) {
+			throw std::runtime_error {"Invalid operands"};
+		}
+
+		set_suffix(1);
+		put_inst_sse(prefix, opcode, dst, src, escape);
+		put_byte(imm.offset);
+
+	}
+
+	/**
+	 * Used for constructing the SSE moves, those have separate load and store opcodes
+	 */
+	void BufferWriter::put_inst_sse_mov(uint8_t prefix, uint8_t load, uint8_t store, const Location& dst, const Location& src) {
+
+		if (dst.is_memory() && src.is_vector()) {
+			put_inst_sse_raw(prefix, store, dst, src.base.pack(), DWORD);
+			return;
+		}
+
+		put_inst_sse(prefix, load, dst, src);
+
+	}
+
+	/**
+	 * Used for constructing the SSE shifts, by a register or by an immediate,
+	 * the immediate form uses the 'inst' field to select the operation
+	 */
+	void BufferWriter::put_inst_sse_shift(uint8_t opcode, uint8_t opcode_imm, uint8_t inst, const Location& dst, const Location& src) {
+
+		if (dst.is_vector() && src.is_immediate()) {
+			put_inst_sse_raw(0x66, opcode_imm, dst, RegInfo::raw(inst), DWORD);
+			put_byte(src.offset);
+			return;
+		}
+
+		// some shifts have no register form
+		if (opcode == 0) {
+			throw std::runtime_error {"Invalid operands"};
+		}
+
+		put_inst_sse(0x66, opcode, dst, src);
+
+	}
+
+	/**
+	 * Used for constructing the SSE instructions that move between a vector and general purpose register,
+	 * the size of the general purpose register (or memory) selects the REX.W form
+	 */
+	void BufferWriter::put_inst_sse_general(uint8_t prefix, uint8_t opcode, const Location& rm, RegInfo packed, uint8_t size) {
+
+		if (size != DWORD && size != QWORD) {
+			throw std::runtime_error {"Invalid operand size, expected dword or qword"};
+		}
+
+		put_inst_sse_raw(prefix, opcode, rm, packed, size);
+
+	}
+
+	/**
+	 * Used for constructing the SSE extract family of instructions, 'dst' is a general purpose register or memory
+	 */
+	void BufferWriter::put_inst_sse_extract(uint8_t escape, uint8_t opcode, uint8_t size, const Location& dst, const Location& src, const Location& imm) {
+
+		const uint8_t reg_size = size == QWORD ? QWORD : DWORD;
+
+		if (!src.is_vector() || !imm.is_immediate()) {
+			throw std::runtime_error {"Invalid operands"};
+		}
+
+		if (dst.is_simple() ? dst.size != reg_size : !(dst.is_memory() && (dst.size == VOID || dst.size == size))) {
+			throw std::runtime_error {"Invalid destination operand"};
+		}
+
+		set_suffix(1);
+		put_inst_sse_raw(0x66, opcode, dst, src.base.pack(), reg_size, escape);
+		put_byte(imm.offset);
+
+	}
+
+	/**
+	 * Used for constructing the SSE insert family of instructions, 'src' is a general purpose register or memory
+	 */
+	void BufferWriter::put_inst_sse_insert(uint8_t escape, uint8_t opcode, uint8_t size, const Location& dst, const Location& src, const Location& imm) {
+
+		const uint8_t reg_size = size == QWORD ? QWORD : DWORD;
+
+		if (!dst.is_vector() || !imm.is_immediate()) {
+			throw std::runtime_error {"Invalid operands"};
+		}
+
+		if (src.is_simple() ? src.size != reg_size : !(src.is_memory() && (src.size == VOID || src.size == size))) {
+			throw std::runtime_error {"Invalid source operand"};
+		}
+
+		set_suffix(1);
+		put_inst_sse_raw(0x66, opcode, src, dst.base.pack(), reg_size, escape);
+		put_byte(imm.offset);
+
+	}
+
+	void BufferWriter::put_inst_sse_raw(uint8_t prefix, uint8_t opcode, const Location& rm, RegInfo packed, uint8_t size, uint8_t escape) {
+
+		// the mandatory prefix needs to go before REX
+		if (prefix) {
+			put_byte(prefix);
+		}
+
+		put_inst_std(opcode, rm, packed, size, true, escape);
+
+	}
+
+	/// Checks if the operand can only be encoded using the EVEX prefix
+	static bool is_evex_only(const Location& location) {
+		return location.size == ZWORD || location.is_masked() || location.is_broadcast() || location.is_opmask() || (location.base.reg & REG_EVEX);
+	}
+
+	void BufferWriter::put_inst_vex_std(uint8_t prefix, uint8_t opcode, const Location& rm, RegInfo packed, uint8_t vvvv, bool l, bool w, uint8_t escape) {
+
+		if (rm.size == ZWORD || rm.is_masked() || rm.is_broadcast() || (vvvv & REG_EVEX)) {
+			throw std::runtime_error {"Invalid operands, AVX-512 operand used in a VEX encoded instruction"};
+		}
+
+		vex = {true, l, prefix, vvvv};
+		put_inst_std(opcode, rm, packed, w ? QWORD : DWORD, true, escape);
+	}
+
+	void BufferWriter::put_inst_evex_std(uint8_t prefix, uint8_t opcode, const Location& rm, RegInfo packed, uint8_t vvvv, const Location& dst, uint8_t size, Evex evex, uint8_t escape) {
+
+		if (size != XWORD && size != YWORD && size != ZWORD) {
+			throw std::runtime_error {"Invalid operand size, expected a vector register"};
+		}
+
+		// the memory operand size selects the scale of the compressed displacement
+		uint8_t disp_scale = size;
+
+		if (evex.tuple == Evex::SCALAR) disp_scale = evex.element;
+		if (evex.tuple == Evex::MEM128) disp_scale = XWORD;
+
+		if (rm.is_broadcast()) {
+			if (evex.tuple != Evex::FULL) {
+				throw std::runtime_error {"Invalid operands, this instruction does not support broadcast"};
+			}
+
+			if (rm.size != VOID && rm.size != evex.element) {
+				throw std::runtime_error {"Invalid operands, broadcast element size mismatch"};
+			}
+
+			disp_scale = evex.element;
+		}
+
+		// the mask comes from the destination, broadcast from the memory operand
+		const Decorator decorator {dst.decorator.mask, dst.decorator.zeroing, rm.decorator.broadcast};
+		const uint8_t l = size == ZWORD ? 2 : size == YWORD ? 1 : 0;
+
+		vex = {true, l, prefix, vvvv, true, disp_scale, decorator};
+		put_inst_std(opcode, rm, packed, evex.w ? QWORD : DWORD, true, escape);
+
+	}
+
+	/**
+	 * Used for constructing any VEX encoded instruction that also has an AVX-512 form, the shorter VEX
+	 * encoding is used unless one of the operands (or the instruction itself) can only be encoded using EVEX
+	 */
+	void BufferWriter::put_inst_avx_any(uint8_t prefix, uint8_t opcode, const Location& rm, RegInfo packed, uint8_t vvvv, const Location& dst, uint8_t size, bool w, Evex evex, uint8_t escape) {
+
+		const bool extended = (packed.reg | vvvv) & REG_EVEX;
+
+		if (!evex.required && !extended && !is_evex_only(rm) && !is_evex_only(dst) && size != ZWORD) {
+			put_inst_vex_std(prefix, opcode, rm, packed, vvvv, size == YWORD, w, escape);
+			return;
+		}
+
+		if (evex.tuple == Evex::NONE) {
+			throw std::runtime_error {"Invalid operands, this instruction has no AVX-512 form"};
+		}
+
+		// a masked memory store or a write to an opmask register can only merge
+		if (dst.decorator.zeroing && (dst.is_memory() || dst.is_opmask())) {
+			throw std::runtime_error {"Invalid operands, zero masking can't be used with this destination"};
+		}
+
+		put_inst_evex_std(prefix, opcode, rm, packed, vvvv, dst, size, evex, escape);
+
+	}
+
+	/**
+	 * Used for constructing the three operand AVX instructions, the operation is 'dst = src1 op src2',
+	 * in AVX-512 the destination of the comparison instructions is an opmask register
+	 */
+	void BufferWriter::put_inst_avx(uint8_t prefix, uint8_t opcode, const Location& dst, const Location& src1, const Location& src2, uint8_t escape, bool w, Evex evex) {
+
+		if (!(dst.is_vector() || dst.is_opmask()) || !src1.is_vector() || !(src2.is_vector() || src2.is_memory())) {
+			throw std::runtime_error {"Invalid operands"};
+		}
+
+		if ((dst.is_vector() && src1.size != dst.size) || (src2.is_vector() && src2.size != src1.size)) {
+			throw std::runtime_error {"Invalid operands, vector registers need to be of the same size"};
+		}
+
+		put_inst_avx_any(prefix, opcode, src2, dst.base.pack(), src1.base.reg, dst, src1.size, w, evex, escape);
+
+	}
+
+	/**
+	 * Used for constructing the three operand AVX instructions that take an additional byte immediate
+	 */
+	void BufferWriter::put_inst_avx_imm(uint8_t prefix, uint8_t opcode, const Location& dst, const Location& src1, const Location& src2, const Location& imm, uint8_t escape, bool w, Evex evex) {
+
+		if (!imm.is_immediate()) {
+			throw std::runtime_error {"Invalid operands"};
+		}
+
+		set_suffix(1);
+		put_inst_avx(prefix, opcode, dst, src1, src2, escape, w, evex);
+		put_byte(imm.offset);
+
+	}
+
+	/**
+	 * Used for constructing the three operand AVX instructions that only operate on the lowest element
+	 */
+	void BufferWriter::put_inst_avx_scalar(uint8_t prefix, uint8_t opcode, const Location& dst, const Location& src1, const Location& src2, uint8_t escape, bool w, Evex evex) {
+
+		if (dst.size != XWORD) {
+			throw std::runtime_error {"Invalid operands, scalar instructions take SSE registers"};
+		}
+
+		put_inst_avx(prefix, opcode, dst, src1, src2, escape, w, evex);
+
+	}
+
+	/**
+	 * Used for constructing the two operand AVX instructions, the operation is 'dst = op src'
+	 */
+	void BufferWriter::put_inst_avx_unary(uint8_t prefix, uint8_t opcode, const Location& dst, const Location& src, uint8_t escape, bool w, Evex evex) {
+
+		if (!dst.is_vector() || !(src.is_vector() || src.is_memory())) {
+			throw std::runtime_error {"Invalid operands"};
+		}
+
+		if (src.is_vector() && src.size != dst.size) {
+			throw std::runtime_error {"Invalid operands, vector registers need to be of the same size"};
+		}
+
+		put_inst_avx_any(prefix, opcode, src, dst.base.pack(), 0, dst, dst.size, w, evex, escape);
+
+	}
+
+	/**
+	 * Used for constructing the two operand AVX instructions that take an additional byte immediate
+	 */
+	void BufferWriter::put_inst_avx_unary_imm(uint8_t prefix, uint8_t opcode, const Location& dst, const Location& src, const Location& imm, uint8_t escape, bool w, Evex evex) {
+
+		if (!imm.is_immediate()) {
+			throw std::runtime_error {"Invalid operands"};
+		}
+
+		set_suffix(1);
+		put_inst_avx_unary(prefix, opcode, dst, src, escape, w, evex);
+		put_byte(imm.offset);
+
+	}
+
+	/**
+	 * Used for constructing the AVX moves, those have separate load and store opcodes
+	 */
+	void BufferWriter::put_inst_avx_mov(uint8_t prefix, uint8_t load, uint8_t store, const Location& dst, const Location& src, Evex evex) {
+
+		// for register to register moves prefer the form that fits in the two byte VEX prefix
+		const bool shorter = dst.is_vector() && src.is_vector() && (src.base.reg & 0b1000) && !(dst.base.reg & 0b1000) && !is_evex_only(dst) && !is_evex_only(src) && !evex.required;
+
+		if (dst.is_memory() && src.is_vector()) {
+			if (dst.is_broadcast()) {
+				throw std::runtime_error {"Invalid operands, can't broadcast into memory"};
+			}
+
+			put_inst_avx_any(prefix, store, dst, src.base.pack(), 0, dst, src.size, false, evex);
+			return;
+		}
+
+		if (shorter) {
+			put_inst_vex_std(prefix, store, dst, src.base.pack(), 0, src.size == YWORD, false);
+			return;
+		}
+
+		put_inst_avx_unary(prefix, load, dst, src, 0, false, evex);
+
+	}
+
+	/**
+	 * Used for constructing the AVX shifts, by an immediate or by the count in the low quadword of a SSE register,
+	 * the immediate form uses the 'inst' field to select the operation and VEX.vvvv for the destination
+	 */
+	void BufferWriter::put_inst_avx_shift(uint8_t opcode, uint8_t opcode_imm, uint8_t inst, const Location& dst, const Location& src, const Location& cnt, Evex evex) {
+
+		if (!dst.is_vector() || !src.is_vector() || dst.size != src.size) {
+			throw std::runtime_error {"Invalid operands"};
+		}
+
+		if (cnt.is_immediate()) {
+			put_inst_avx_any(0x66, opcode_imm, src, RegInfo::raw(inst), dst.base.reg, dst, dst.size, false, evex);
+			put_byte(cnt.offset);
+			return;
+		}
+
+		// some shifts have no register form, the count is always 128 bit
+		if (opcode == 0 || !((cnt.is_vector() && cnt.size == XWORD) || cnt.is_memory())) {
+			throw std::runtime_error {"Invalid operands"};
+		}
+
+		const Evex count {evex.tuple == Evex::NONE ? Evex::NONE : Evex::MEM128, evex.element, evex.w, evex.required};
+		put_inst_avx_any(0x66, opcode, cnt, dst.base.pack(), src.base.reg, dst, dst.size, false, count);
+
+	}
+
+	/**
+	 * Used for constructing the AVX broadcasts, those always take a SSE register or memory as the source
+	 */
+	void BufferWriter::put_inst_avx_broadcast(uint8_t opcode, const Location& dst, const Location& src, bool register_source, Evex evex) {
+
+		if (!dst.is_vector() || !((register_source && src.is_vector() && src.size == XWORD) || src.is_memory())) {
+			throw std::runtime_error {"Invalid operands"};
+		}
+
+		put_inst_avx_any(0x66, opcode, src, dst.base.pack(), 0, dst, dst.size, false, evex, 0x38);
+
+	}
+
+	/**
+	 * Used for constructing the AVX2 gather family of instructions, 'src' needs to use
+	 * a vector register as the index, elements are only loaded when the sign bit of the mask is set
+	 */
+	void BufferWriter::put_inst_avx_gather(uint8_t opcode, bool w, const Location& dst, const Location& src, const Location& mask) {
+
+		if (!dst.is_vector() || !mask.is_vector() || !src.is_memory() || !src.is_vector_indexed() || dst.size != mask.size) {
+			throw std::runtime_error {"Invalid operands"};
+		}
+
+		// the AVX-512 gathers use an opmask register instead and are not supported
+		if (is_evex_only(dst) || is_evex_only(mask) || src.index.size == ZWORD) {
+			throw std::runtime_error {"Invalid operands, expected AVX2 vector registers"};
+		}
+
+		if (dst.base.reg == mask.base.reg || dst.base.reg == src.index.reg || mask.base.reg == src.index.reg) {
+			throw std::runtime_error {"Invalid operands, destination, index and mask registers need to be different"};
+		}
+
+		put_inst_vex_std(0x66, opcode, src, dst.base.pack(), mask.base.reg, dst.size == YWORD || src.index.size == YWORD, w, 0x38);
+
+	}
+
+	/**
+	 * Used for constructing the POPCNT, LZCNT and TZCNT instructions, those use the mandatory F3 prefix
+	 * and unlike BSF and BSR have a well-defined result when the source is zero
+	 */
+	void BufferWriter::put_inst_bit_count(uint8_t opcode, const Location& dst, const Location& src) {
+
+		const uint8_t size = pair_size(src, dst);
+
+		if (size != WORD && size != DWORD && size != QWORD) {
+			throw std::runtime_error {"Invalid operand size, expected word, dword or qword"};
+		}
+
+		if (!dst.is_simple() || !src.is_memreg()) {
+			throw std::runtime_error {"Invalid operands"};
+		}
+
+		put_inst_sse_raw(0xF3, opcode, src, dst.base.pack(), size);
+
+	}
+
+	/**
+	 * Used for constructing the VEX encoded general purpose register instructions (BMI1, BMI2),
+	 * 'vvvv' is the additional register operand, the operand size is selected with VEX.W
+	 */
+	void BufferWriter::put_inst_bmi(uint8_t prefix, uint8_t opcode, const Location& dst, const Location& vvvv, const Location& rm, uint8_t escape) {
+
+		if (dst.size != DWORD && dst.size != QWORD) {
+			throw std::runtime_error {"Invalid operand size, expected dword or qword"};
+		}
+
+		if (!dst.is_simple() || !vvvv.is_simple() || !rm.is_memreg() || vvvv.size != dst.size || pair_size(dst, rm) != dst.size) {
+			throw std::runtime_error {"Invalid operands"};
+		}
+
+		put_inst_vex_std(prefix, opcode, rm, dst.base.pack(), vvvv.base.reg, false, dst.size == QWORD, escape);
+
+	}
+
+	/**
+	 * Used for constructing the BMI1 instructions that take the destination in VEX.vvvv,
+	 * the 'inst' field in ModRM.reg selects the operation
+	 */
+	void BufferWriter::put_inst_bmi_unary(uint8_t opcode, uint8_t inst, const Location& dst, const Location& src) {
+
+		if (dst.size != DWORD && dst.size != QWORD) {
+			throw std::runtime_error {"Invalid operand size, expected dword or qword"};
+		}
+
+		if (!dst.is_simple() || !src.is_memreg() || pair_size(dst, src) != dst.size) {
+			throw std::runtime_error {"Invalid operands"};
+		}
+
+		put_inst_vex_std(0, opcode, src, RegInfo::raw(inst), dst.base.reg, false, dst.size == QWORD, 0x38);
+
+	}
+
+	/**
+	 * Used for constructing the AVX-512 compress instructions, those store the
+	 * elements selected by the opmask of 'src' contiguously into 'dst'
+	 */
+	void BufferWriter::put_inst_avx_compress(uint8_t opcode, uint8_t element, const Location& dst, const Location& src) {
+
+		if (!src.is_vector() || !((dst.is_vector() && dst.size == src.size) || dst.is_memory()) || src.is_masked()) {
+			throw std::runtime_error {"Invalid operands"};
+		}
+
+		put_inst_avx_any(0x66, opcode, dst, src.base.pack(), 0, dst, src.size, false, Evex::scalar(element).only(), 0x38);
+
+	}
+
+	/// The byte and doubleword opmask instructions use the 0x66 prefix, the wider of each pair sets VEX.W
+	static uint8_t get_opmask_prefix(uint8_t size) {
+		return (size == BYTE || size == DWORD) ? 0x66 : 0;
+	}
+
+	/**
+	 * Used for constructing the KMOV family of instructions, the moves between
+	 * opmask and general purpose registers use different prefixes than the rest
+	 */
+	void BufferWriter::put_inst_kmov(uint8_t size, const Location& dst, const Location& src) {
+
+		const bool w = size == DWORD || size == QWORD;
+
+		if (dst.is_opmask() && (src.is_opmask() || (src.is_memory() && (src.size == VOID || src.size == size)))) {
+			put_inst_vex_std(get_opmask_prefix(size), 0x90, src, dst.base.pack(), 0, false, w);
+			return;
+		}
+
+		if (dst.is_memory() && (dst.size == VOID || dst.size == size) && src.is_opmask()) {
+			put_inst_vex_std(get_opmask_prefix(size), 0x91, dst, src.base.pack(), 0, false, w);
+			return;
+		}
+
+		// 8, 16 and 32 bit masks all use a 32 bit general purpose register
+		const uint8_t reg_size = size == QWORD ? QWORD : DWORD;
+		const uint8_t prefix = size == BYTE ? 0x66 : size == WORD ? 0 : 0xF2;
+
+		if (dst.is_opmask() && src.is_simple() && src.size == reg_size) {
+			put_inst_vex_std(prefix, 0x92, src, dst.base.pack(), 0, false, size == QWORD);
+			return;
+		}
+
+		if (dst.is_simple() && dst.size == reg_size && src.is_opmask()) {
+			put_inst_vex_std(prefix, 0x93, src, dst.base.pack(), 0, false, size == QWORD);
+			return;
+		}
+
+		throw std::runtime_error {"Invalid operands"};
+
+	}
+
+	/**
+	 * Used for constructing the three operand opmask instructions, the operation is 'dst = src1 op src2'
+	 */
+	void BufferWriter::put_inst_opmask(uint8_t opcode, uint8_t size, const Location& dst, const Location& src1, const Location& src2) {
+
+		if (!dst.is_opmask() || !src1.is_opmask() || !src2.is_opmask()) {
+			throw std::runtime_error {"Invalid operands, expected opmask registers"};
+		}
+
+		put_inst_vex_std(get_opmask_prefix(size), opcode, src2, dst.base.pack(), src1.base.reg, true, size == DWORD || size == QWORD);
+
+	}
+
+	/**
+	 * Used for constructing the two operand opmask instructions
+	 */
+	void BufferWriter::put_inst_opmask_unary(uint8_t opcode, uint8_t size, const Location& dst, const Location& src) {
+
+		if (!dst.is_opmask() || !src.is_opmask()) {
+			throw std::runtime_error {"Invalid operands, expected opmask registers"};
+		}
+
+		put_inst_vex_std(get_opmask_prefix(size), opcode, src, dst.base.pack(), 0, false, size == DWORD || size == QWORD);
+
+	}
+
 	void BufferWriter::put_rex_w() {
 		put_byte(REX_PREFIX | REX_BIT_W);
 	}
@@ -555,8 +1170,33 @@ namespace asmio::x86 {
 		return suffix;
 	}
 
+	void BufferWriter::put_nops(uint8_t* target, size_t bytes) {
+
+		// the '0F 1F /0' forms recommended by the Intel manual, indexed by their length, longer gaps are filled with a sequence of the longest one
+		static constexpr uint8_t nops[9][9] = {
+			{0x90},
+			{0x66, 0x90},
+			{0x0F, 0x1F, 0x00},
+			{0x0F, 0x1F, 0x40, 0x00},
+			{0x0F, 0x1F, 0x44, 0x00, 0x00},
+			{0x66, 0x0F, 0x1F, 0x44, 0x00, 0x00},
+			{0x0F, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00},
+			{0x0F, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00},
+			{0x66, 0x0F, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00},
+		};
+
+		while (bytes > 0) {
+			const size_t length = std::min<size_t>(bytes, 9);
+			memcpy(target, nops[length - 1], length);
+
+			target += length;
+			bytes -= length;
+		}
+
+	}
+
 	BufferWriter::BufferWriter(SegmentedBuffer& buffer)
-		: BasicBufferWriter(buffer) {
+		: BasicBufferWriter(buffer, put_nops) {
 	}
 
 }
\ No newline at end of file
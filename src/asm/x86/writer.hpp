@@ -13,24 +13,81 @@ namespace asmio::x86 {
 		ABSOLUTE,
 	};
 
+	/// Describes the AVX-512 (EVEX) form of a vector instruction
+	struct Evex {
+
+		/// Selects the memory operand size used to scale the compressed 8 bit displacement (disp8*N)
+		enum Tuple : uint8_t {
+			NONE,     // there is no EVEX form of this instruction
+			FULL,     // whole vector, or a single element when broadcast
+			FULL_MEM, // whole vector, broadcast is not supported
+			SCALAR,   // single element (Tuple1 Scalar)
+			MEM128,   // always 128 bits, used by the shift count operand
+		};
+
+		Tuple tuple = NONE;
+		uint8_t element = VOID; // size of a single vector element
+		bool w = false;         // value of the EVEX.W bit, not always the same as in the VEX form
+		bool required = false;  // there is no VEX form of this instruction
+
+		static constexpr Evex full(uint8_t element) {
+			return {FULL, element, element == QWORD};
+		}
+
+		static constexpr Evex full_mem(uint8_t element) {
+			return {FULL_MEM, element, element == QWORD};
+		}
+
+		static constexpr Evex scalar(uint8_t element) {
+			return {SCALAR, element, element == QWORD};
+		}
+
+		/// Mark this instruction as AVX-512 only
+		constexpr Evex only() const {
+			return {tuple, element, w, true};
+		}
+
+	};
+
 	class BufferWriter : public BasicBufferWriter {
 
 		private:
 
+			/// Fields of the VEX and EVEX prefix, the rest is taken from the 'standard' instruction that uses it
+			struct VexPrefix {
+				bool enabled = false;
+				uint8_t l = 0;          // vector length, 0 for 128, 1 for 256, and 2 for 512 bit vectors
+				uint8_t prefix = 0;     // the mandatory SSE prefix this replaces (0x66, 0xF2, 0xF3) or zero
+				uint8_t vvvv = 0;       // the additional register operand, zero when not used
+				bool evex = false;      // use the four byte EVEX prefix instead
+				uint8_t disp_scale = 1; // the 8 bit displacement is multiplied by this value (EVEX only)
+				Decorator decorator {}; // opmask, zeroing and broadcast flags (EVEX only)
+			};
+
 			// number of bytes after the 'standard' instruction body
 			// this is needed for the x86-64 RIP-relative addressing to work
 			uint32_t suffix = 0;
 
+			// when enabled the next 'standard' instruction will
+			// use it in place of REX and the opcode escape bytes
+			VexPrefix vex;
+
 			void put_linker_command(const Label& label, int32_t addend, int32_t shift, uint8_t width, LinkType type);
 			void put_inst_rex(bool w, bool r, bool x, bool b);
+			void put_inst_vex(const VexPrefix& vex, bool w, bool r, bool x, bool b, uint8_t map);
+			void put_inst_evex(const VexPrefix& vex, bool w, uint8_t reg, bool x, bool b, uint8_t map);
+
+			/// Emit the REX prefix (if needed) and the opcode escape bytes, or the (E)VEX prefix that encodes both,
+			/// 'reg' is the whole register number from ModRM.reg as EVEX needs more than its 4th bit
+			void put_inst_opcode_prefix(const VexPrefix& vex, bool rex, bool w, uint8_t reg, bool x, bool b, bool longer, uint8_t escape);
 			uint8_t pack_opcode_dw(uint8_t opcode, bool d, bool w);
 			void put_inst_mod_reg_rm(uint8_t mod, uint8_t reg, uint8_t r_m);
 			void put_inst_sib(uint8_t ss, uint8_t index, uint8_t base);
 			void put_inst_imm(uint64_t immediate, uint8_t width);
 			void put_inst_label_imm(Location imm, uint8_t size);
 
-			/// Encode a 'standard' ModRM/SIB instruction with REX/size prefixes
-			void put_inst_std(uint8_t opcode, const Location& dst, RegInfo packed, uint8_t size, bool longer = false);
+			/// Encode a 'standard' ModRM/SIB instruction with REX/size prefixes, the 'escape' byte (0x38 or 0x3A) selects a three byte opcode
+			void put_inst_std(uint8_t opcode, const Location& dst, RegInfo packed, uint8_t size, bool longer = false, uint8_t escape = 0);
 			void put_inst_std_ri(uint8_t opcode, const Location& dst, uint8_t inst);
 			void put_inst_std_as(uint8_t opcode, const Location& dst, RegInfo packed, bool longer = false);
 			void put_inst_std_dw(uint8_t opcode, const Location& dst, RegInfo packed, uint8_t size, bool direction, bool wide, bool longer = false);
@@ -65,6 +122,87 @@ namespace asmio::x86 {
 			/// Used for constructing the 'set byte' family of instructions
 			void put_inst_setx(const Location& dst, uint8_t lopcode);
 
+			/// Used for constructing the SSE instructions, 'prefix' is the mandatory prefix (0x66, 0xF2, 0xF3) or zero
+			void put_inst_sse(uint8_t prefix, uint8_t opcode, const Location& dst, const Location& src, uint8_t escape = 0);
+
+			/// Used for constructing the SSE instructions that take an additional byte immediate
+			void put_inst_sse_imm(uint8_t prefix, uint8_t opcode, const Location& dst, const Location& src, const Location& imm, uint8_t escape = 0);
+
+			/// Used for constructing the SSE moves, those have separate load and store opcodes
+			void put_inst_sse_mov(uint8_t prefix, uint8_t load, uint8_t store, const Location& dst, const Location& src);
+
+			/// Used for constructing the SSE shifts, by a register or by an immediate
+			void put_inst_sse_shift(uint8_t opcode, uint8_t opcode_imm, uint8_t inst, const Location& dst, const Location& src);
+
+			/// Used for constructing the SSE instructions that move between a vector and general purpose register
+			void put_inst_sse_general(uint8_t prefix, uint8_t opcode, const Location& rm, RegInfo packed, uint8_t size);
+
+			/// Used for constructing the SSE extract family of instructions
+			void put_inst_sse_extract(uint8_t escape, uint8_t opcode, uint8_t size, const Location& dst, const Location& src, const Location& imm);
+
+			/// Used for constructing the SSE insert family of instructions
+			void put_inst_sse_insert(uint8_t escape, uint8_t opcode, uint8_t size, const Location& dst, const Location& src, const Location& imm);
+
+			/// Emit the mandatory SSE prefix followed by a 'standard' two or three byte opcode instruction
+			void put_inst_sse_raw(uint8_t prefix, uint8_t opcode, const Location& rm, RegInfo packed, uint8_t size, uint8_t escape = 0);
+
+			/// Encode a 'standard' instruction using the VEX prefix, 'vvvv' is the number of the additional register operand
+			void put_inst_vex_std(uint8_t prefix, uint8_t opcode, const Location& rm, RegInfo packed, uint8_t vvvv, bool l, bool w, uint8_t escape = 0);
+
+			/// Encode a 'standard' instruction using the EVEX prefix, masking is taken from 'dst' and broadcast from 'rm'
+			void put_inst_evex_std(uint8_t prefix, uint8_t opcode, const Location& rm, RegInfo packed, uint8_t vvvv, const Location& dst, uint8_t size, Evex evex, uint8_t escape = 0);
+
+			/// Encode a vector instruction using VEX, or EVEX if any of the operands can only be expressed with AVX-512
+			void put_inst_avx_any(uint8_t prefix, uint8_t opcode, const Location& rm, RegInfo packed, uint8_t vvvv, const Location& dst, uint8_t size, bool w, Evex evex, uint8_t escape = 0);
+
+			/// Used for constructing the three operand AVX instructions, the operation is 'dst = src1 op src2'
+			void put_inst_avx(uint8_t prefix, uint8_t opcode, const Location& dst, const Location& src1, const Location& src2, uint8_t escape = 0, bool w = false, Evex evex = {});
+
+			/// Used for constructing the three operand AVX instructions that take an additional byte immediate
+			void put_inst_avx_imm(uint8_t prefix, uint8_t opcode, const Location& dst, const Location& src1, const Location& src2, const Location& imm, uint8_t escape = 0, bool w = false, Evex evex = {});
+
+			/// Used for constructing the three operand AVX instructions that only operate on the lowest element
+			void put_inst_avx_scalar(uint8_t prefix, uint8_t opcode, const Location& dst, const Location& src1, const Location& src2, uint8_t escape = 0, bool w = false, Evex evex = {});
+
+			/// Used for constructing the two operand AVX instructions, the operation is 'dst = op src'
+			void put_inst_avx_unary(uint8_t prefix, uint8_t opcode, const Location& dst, const Location& src, uint8_t escape = 0, bool w = false, Evex evex = {});
+
+			/// Used for constructing the two operand AVX instructions that take an additional byte immediate
+			void put_inst_avx_unary_imm(uint8_t prefix, uint8_t opcode, const Location& dst, const Location& src, const Location& imm, uint8_t escape = 0, bool w = false, Evex evex = {});
+
+			/// Used for constructing the AVX moves, those have separate load and store opcodes
+			void put_inst_avx_mov(uint8_t prefix, uint8_t load, uint8_t store, const Location& dst, const Location& src, Evex evex = {});
+
+			/// Used for constructing the AVX shifts, by an immediate or by the count in the low quadword of a SSE register
+			void put_inst_avx_shift(uint8_t opcode, uint8_t opcode_imm, uint8_t inst, const Location& dst, const Location& src, const Location& cnt, Evex evex = {});
+
+			/// Used for constructing the AVX broadcasts, those always take a SSE register or memory as the source
+			void put_inst_avx_broadcast(uint8_t opcode, const Location& dst, const Location& src, bool register_source = true, Evex evex = {});
+
+			/// Used for constructing the AVX2 gather family of instructions
+			void put_inst_avx_gather(uint8_t opcode, bool w, const Location& dst, const Location& src, const Location& mask);
+
+			/// Used for constructing the POPCNT, LZCNT and TZCNT instructions
+			void put_inst_bit_count(uint8_t opcode, const Location& dst, const Location& src);
+
+			/// Used for constructing the VEX encoded general purpose register instructions (BMI1, BMI2), the operation is 'dst = vvvv op rm'
+			void put_inst_bmi(uint8_t prefix, uint8_t opcode, const Location& dst, const Location& vvvv, const Location& rm, uint8_t escape = 0x38);
+
+			/// Used for constructing the BMI1 instructions that take the destination in VEX.vvvv and an opcode extension in ModRM.reg
+			void put_inst_bmi_unary(uint8_t opcode, uint8_t inst, const Location& dst, const Location& src);
+
+			/// Used for constructing the AVX-512 compress family of instructions
+			void put_inst_avx_compress(uint8_t opcode, uint8_t element, const Location& dst, const Location& src);
+
+			/// Used for constructing the AVX-512 opmask moves
+			void put_inst_kmov(uint8_t size, const Location& dst, const Location& src);
+
+			/// Used for constructing the three operand AVX-512 opmask instructions, the operation is 'dst = src1 op src2'
+			void put_inst_opmask(uint8_t opcode, uint8_t size, const Location& dst, const Location& src1, const Location& src2);
+
+			/// Used for constructing the two operand AVX-512 opmask instructions
+			void put_inst_opmask_unary(uint8_t opcode, uint8_t size, const Location& dst, const Location& src);
+
 			/// Add the REX.W prefix
 			void put_rex_w();
 
@@ -82,6 +220,9 @@ namespace asmio::x86 {
 
 			BufferWriter(SegmentedBuffer& buffer);
 
+			/// Write the recommended multi-byte NOP sequences, used as the filler of align()
+			static void put_nops(uint8_t* target, size_t bytes);
+
 			// string (i386)
 			PREFIX put_rep();                           ///< Repeat
 			PREFIX put_repe();                          ///< Repeat while equal
@@ -278,6 +419,26 @@ namespace asmio::x86 {
 			INST put_sysretl();                         ///< Return From Fast System Call into Long Mode
 			INST put_sysretc();                         ///< Return From Fast System Call into Compatibility Mode
 
+			// bit manipulation (POPCNT, LZCNT, BMI1, BMI2, ADX)
+			INST put_popcnt(Location dst, Location src); ///< Population Count
+			INST put_lzcnt(Location dst, Location src); ///< Count Leading Zero Bits
+			INST put_tzcnt(Location dst, Location src); ///< Count Trailing Zero Bits
+			INST put_andn(Location dst, Location src1, Location src2); ///< Bitwise AND NOT, the first source is inverted
+			INST put_bextr(Location dst, Location src, Location ctl); ///< Bit Field Extract, start and length are in the control register
+			INST put_blsi(Location dst, Location src);  ///< Extract Lowest Set Bit
+			INST put_blsmsk(Location dst, Location src); ///< Mask Up to Lowest Set Bit
+			INST put_blsr(Location dst, Location src);  ///< Reset Lowest Set Bit
+			INST put_bzhi(Location dst, Location src, Location idx); ///< Zero High Bits Starting with Specified Bit Position
+			INST put_pdep(Location dst, Location src, Location mask); ///< Parallel Bits Deposit
+			INST put_pext(Location dst, Location src, Location mask); ///< Parallel Bits Extract
+			INST put_shlx(Location dst, Location src, Location cnt); ///< Shift Left Logical Without Affecting Flags
+			INST put_shrx(Location dst, Location src, Location cnt); ///< Shift Right Logical Without Affecting Flags
+			INST put_sarx(Location dst, Location src, Location cnt); ///< Shift Right Arithmetic Without Affecting Flags
+			INST put_rorx(Location dst, Location src, Location imm); ///< Rotate Right Without Affecting Flags
+			INST put_mulx(Location high, Location low, Location src); ///< Unsigned Multiply by EDX/RDX Without Affecting Flags
+			INST put_adcx(Location dst, Location src);  ///< Add with Carry Flag, only affects CF
+			INST put_adox(Location dst, Location src);  ///< Add with Overflow Flag, only affects OF
+
 			// floating-point
 			INST put_fnop();                            ///< No Operation
 			INST put_finit();                           ///< Initialize FPU
@@ -353,6 +514,405 @@ namespace asmio::x86 {
 			INST put_fdivr(Location dst, Location src); ///< Reverse Divide
 			INST put_fdivrp(Location dst);              ///< Reverse Divide And Pop
 
+			// sse
+			INST put_movaps(Location dst, Location src); ///< Move Aligned Packed Single-Precision Floats
+			INST put_movups(Location dst, Location src); ///< Move Unaligned Packed Single-Precision Floats
+			INST put_movapd(Location dst, Location src); ///< Move Aligned Packed Double-Precision Floats
+			INST put_movupd(Location dst, Location src); ///< Move Unaligned Packed Double-Precision Floats
+			INST put_movdqa(Location dst, Location src); ///< Move Aligned Packed Integers
+			INST put_movdqu(Location dst, Location src); ///< Move Unaligned Packed Integers
+			INST put_movss(Location dst, Location src); ///< Move Scalar Single-Precision Float
+			INST put_movsd(Location dst, Location src); ///< Move Scalar Double-Precision Float
+			INST put_movd(Location dst, Location src);  ///< Move Doubleword
+			INST put_movq(Location dst, Location src);  ///< Move Quadword
+			INST put_movmskps(Location dst, Location src); ///< Extract Packed Single-Precision Float Sign Mask
+			INST put_movmskpd(Location dst, Location src); ///< Extract Packed Double-Precision Float Sign Mask
+			INST put_pmovmskb(Location dst, Location src); ///< Move Byte Mask
+			INST put_addps(Location dst, Location src); ///< Add Packed Single-Precision Floats
+			INST put_addpd(Location dst, Location src); ///< Add Packed Double-Precision Floats
+			INST put_addss(Location dst, Location src); ///< Add Scalar Single-Precision Float
+			INST put_addsd(Location dst, Location src); ///< Add Scalar Double-Precision Float
+			INST put_subps(Location dst, Location src); ///< Subtract Packed Single-Precision Floats
+			INST put_subpd(Location dst, Location src); ///< Subtract Packed Double-Precision Floats
+			INST put_subss(Location dst, Location src); ///< Subtract Scalar Single-Precision Float
+			INST put_subsd(Location dst, Location src); ///< Subtract Scalar Double-Precision Float
+			INST put_mulps(Location dst, Location src); ///< Multiply Packed Single-Precision Floats
+			INST put_mulpd(Location dst, Location src); ///< Multiply Packed Double-Precision Floats
+			INST put_mulss(Location dst, Location src); ///< Multiply Scalar Single-Precision Float
+			INST put_mulsd(Location dst, Location src); ///< Multiply Scalar Double-Precision Float
+			INST put_divps(Location dst, Location src); ///< Divide Packed Single-Precision Floats
+			INST put_divpd(Location dst, Location src); ///< Divide Packed Double-Precision Floats
+			INST put_divss(Location dst, Location src); ///< Divide Scalar Single-Precision Float
+			INST put_divsd(Location dst, Location src); ///< Divide Scalar Double-Precision Float
+			INST put_minps(Location dst, Location src); ///< Minimum of Packed Single-Precision Floats
+			INST put_minpd(Location dst, Location src); ///< Minimum of Packed Double-Precision Floats
+			INST put_minss(Location dst, Location src); ///< Minimum of Scalar Single-Precision Float
+			INST put_minsd(Location dst, Location src); ///< Minimum of Scalar Double-Precision Float
+			INST put_maxps(Location dst, Location src); ///< Maximum of Packed Single-Precision Floats
+			INST put_maxpd(Location dst, Location src); ///< Maximum of Packed Double-Precision Floats
+			INST put_maxss(Location dst, Location src); ///< Maximum of Scalar Single-Precision Float
+			INST put_maxsd(Location dst, Location src); ///< Maximum of Scalar Double-Precision Float
+			INST put_sqrtps(Location dst, Location src); ///< Square Root of Packed Single-Precision Floats
+			INST put_sqrtpd(Location dst, Location src); ///< Square Root of Packed Double-Precision Floats
+			INST put_sqrtss(Location dst, Location src); ///< Square Root of Scalar Single-Precision Float
+			INST put_sqrtsd(Location dst, Location src); ///< Square Root of Scalar Double-Precision Float
+			INST put_andps(Location dst, Location src); ///< Bitwise AND of Packed Single-Precision Floats
+			INST put_andpd(Location dst, Location src); ///< Bitwise AND of Packed Double-Precision Floats
+			INST put_andnps(Location dst, Location src); ///< Bitwise AND NOT of Packed Single-Precision Floats
+			INST put_andnpd(Location dst, Location src); ///< Bitwise AND NOT of Packed Double-Precision Floats
+			INST put_orps(Location dst, Location src);  ///< Bitwise OR of Packed Single-Precision Floats
+			INST put_orpd(Location dst, Location src);  ///< Bitwise OR of Packed Double-Precision Floats
+			INST put_xorps(Location dst, Location src); ///< Bitwise XOR of Packed Single-Precision Floats
+			INST put_xorpd(Location dst, Location src); ///< Bitwise XOR of Packed Double-Precision Floats
+			INST put_cmpps(Location dst, Location src, Location imm); ///< Compare Packed Single-Precision Floats, using the predicate given as immediate
+			INST put_cmppd(Location dst, Location src, Location imm); ///< Compare Packed Double-Precision Floats, using the predicate given as immediate
+			INST put_cmpss(Location dst, Location src, Location imm); ///< Compare Scalar Single-Precision Float, using the predicate given as immediate
+			INST put_cmpsd(Location dst, Location src, Location imm); ///< Compare Scalar Double-Precision Float, using the predicate given as immediate
+			INST put_ucomiss(Location dst, Location src); ///< Unordered Compare Scalar Single-Precision Floats and set EFLAGS
+			INST put_ucomisd(Location dst, Location src); ///< Unordered Compare Scalar Double-Precision Floats and set EFLAGS
+			INST put_comiss(Location dst, Location src); ///< Compare Scalar Single-Precision Floats and set EFLAGS
+			INST put_comisd(Location dst, Location src); ///< Compare Scalar Double-Precision Floats and set EFLAGS
+			INST put_cvtsi2ss(Location dst, Location src); ///< Convert Integer to Scalar Single-Precision Float
+			INST put_cvtsi2sd(Location dst, Location src); ///< Convert Integer to Scalar Double-Precision Float
+			INST put_cvtss2si(Location dst, Location src); ///< Convert Scalar Single-Precision Float to Integer
+			INST put_cvtsd2si(Location dst, Location src); ///< Convert Scalar Double-Precision Float to Integer
+			INST put_cvttss2si(Location dst, Location src); ///< Convert with Truncation Scalar Single-Precision Float to Integer
+			INST put_cvttsd2si(Location dst, Location src); ///< Convert with Truncation Scalar Double-Precision Float to Integer
+			INST put_cvtss2sd(Location dst, Location src); ///< Convert Scalar Single-Precision Float to Scalar Double-Precision Float
+			INST put_cvtsd2ss(Location dst, Location src); ///< Convert Scalar Double-Precision Float to Scalar Single-Precision Float
+			INST put_cvtps2pd(Location dst, Location src); ///< Convert Packed Single-Precision Floats to Packed Double-Precision Floats
+			INST put_cvtpd2ps(Location dst, Location src); ///< Convert Packed Double-Precision Floats to Packed Single-Precision Floats
+			INST put_cvtdq2ps(Location dst, Location src); ///< Convert Packed Doubleword Integers to Packed Single-Precision Floats
+			INST put_cvtps2dq(Location dst, Location src); ///< Convert Packed Single-Precision Floats to Packed Doubleword Integers
+			INST put_cvttps2dq(Location dst, Location src); ///< Convert with Truncation Packed Single-Precision Floats to Packed Doubleword Integers
+			INST put_paddb(Location dst, Location src); ///< Add Packed Byte Integers
+			INST put_paddw(Location dst, Location src); ///< Add Packed Word Integers
+			INST put_paddd(Location dst, Location src); ///< Add Packed Doubleword Integers
+			INST put_paddq(Location dst, Location src); ///< Add Packed Quadword Integers
+			INST put_psubb(Location dst, Location src); ///< Subtract Packed Byte Integers
+			INST put_psubw(Location dst, Location src); ///< Subtract Packed Word Integers
+			INST put_psubd(Location dst, Location src); ///< Subtract Packed Doubleword Integers
+			INST put_psubq(Location dst, Location src); ///< Subtract Packed Quadword Integers
+			INST put_pmullw(Location dst, Location src); ///< Multiply Packed Word Integers and Store Low Result
+			INST put_pmulld(Location dst, Location src); ///< Multiply Packed Doubleword Integers and Store Low Result
+			INST put_pmuludq(Location dst, Location src); ///< Multiply Packed Unsigned Doubleword Integers into Quadwords
+			INST put_pand(Location dst, Location src);  ///< Bitwise AND
+			INST put_pandn(Location dst, Location src); ///< Bitwise AND NOT
+			INST put_por(Location dst, Location src);   ///< Bitwise OR
+			INST put_pxor(Location dst, Location src);  ///< Bitwise XOR
+			INST put_pcmpeqb(Location dst, Location src); ///< Compare Packed Bytes for Equal
+			INST put_pcmpeqw(Location dst, Location src); ///< Compare Packed Words for Equal
+			INST put_pcmpeqd(Location dst, Location src); ///< Compare Packed Doublewords for Equal
+			INST put_pcmpeqq(Location dst, Location src); ///< Compare Packed Quadwords for Equal
+			INST put_pcmpgtb(Location dst, Location src); ///< Compare Packed Signed Bytes for Greater Than
+			INST put_pcmpgtw(Location dst, Location src); ///< Compare Packed Signed Words for Greater Than
+			INST put_pcmpgtd(Location dst, Location src); ///< Compare Packed Signed Doublewords for Greater Than
+			INST put_pcmpgtq(Location dst, Location src); ///< Compare Packed Signed Quadwords for Greater Than
+			INST put_pminub(Location dst, Location src); ///< Minimum of Packed Unsigned Bytes
+			INST put_pmaxub(Location dst, Location src); ///< Maximum of Packed Unsigned Bytes
+			INST put_pminsd(Location dst, Location src); ///< Minimum of Packed Signed Doublewords
+			INST put_pmaxsd(Location dst, Location src); ///< Maximum of Packed Signed Doublewords
+			INST put_pminud(Location dst, Location src); ///< Minimum of Packed Unsigned Doublewords
+			INST put_pmaxud(Location dst, Location src); ///< Maximum of Packed Unsigned Doublewords
+			INST put_punpcklbw(Location dst, Location src); ///< Unpack and Interleave Low-Order Bytes
+			INST put_punpcklwd(Location dst, Location src); ///< Unpack and Interleave Low-Order Words
+			INST put_punpckldq(Location dst, Location src); ///< Unpack and Interleave Low-Order Doublewords
+			INST put_punpcklqdq(Location dst, Location src); ///< Unpack and Interleave Low-Order Quadwords
+			INST put_punpckhbw(Location dst, Location src); ///< Unpack and Interleave High-Order Bytes
+			INST put_punpckhwd(Location dst, Location src); ///< Unpack and Interleave High-Order Words
+			INST put_punpckhdq(Location dst, Location src); ///< Unpack and Interleave High-Order Doublewords
+			INST put_punpckhqdq(Location dst, Location src); ///< Unpack and Interleave High-Order Quadwords
+			INST put_packsswb(Location dst, Location src); ///< Pack Words into Bytes with Signed Saturation
+			INST put_packssdw(Location dst, Location src); ///< Pack Doublewords into Words with Signed Saturation
+			INST put_packuswb(Location dst, Location src); ///< Pack Words into Bytes with Unsigned Saturation
+			INST put_pshufb(Location dst, Location src); ///< Shuffle Packed Bytes
+			INST put_ptest(Location dst, Location src); ///< Logical Compare and set ZF and CF
+			INST put_pshufd(Location dst, Location src, Location imm); ///< Shuffle Packed Doublewords
+			INST put_pshuflw(Location dst, Location src, Location imm); ///< Shuffle Packed Low Words
+			INST put_pshufhw(Location dst, Location src, Location imm); ///< Shuffle Packed High Words
+			INST put_shufps(Location dst, Location src, Location imm); ///< Shuffle Packed Single-Precision Floats
+			INST put_shufpd(Location dst, Location src, Location imm); ///< Shuffle Packed Double-Precision Floats
+			INST put_palignr(Location dst, Location src, Location imm); ///< Packed Align Right
+			INST put_psllw(Location dst, Location src); ///< Shift Packed Words Left Logical
+			INST put_pslld(Location dst, Location src); ///< Shift Packed Doublewords Left Logical
+			INST put_psllq(Location dst, Location src); ///< Shift Packed Quadwords Left Logical
+			INST put_psrlw(Location dst, Location src); ///< Shift Packed Words Right Logical
+			INST put_psrld(Location dst, Location src); ///< Shift Packed Doublewords Right Logical
+			INST put_psrlq(Location dst, Location src); ///< Shift Packed Quadwords Right Logical
+			INST put_psraw(Location dst, Location src); ///< Shift Packed Words Right Arithmetic
+			INST put_psrad(Location dst, Location src); ///< Shift Packed Doublewords Right Arithmetic
+			INST put_pslldq(Location dst, Location src); ///< Shift Double Quadword Left Logical, by bytes
+			INST put_psrldq(Location dst, Location src); ///< Shift Double Quadword Right Logical, by bytes
+			INST put_pextrb(Location dst, Location src, Location imm); ///< Extract Byte
+			INST put_pextrw(Location dst, Location src, Location imm); ///< Extract Word
+			INST put_pextrd(Location dst, Location src, Location imm); ///< Extract Doubleword
+			INST put_pextrq(Location dst, Location src, Location imm); ///< Extract Quadword
+			INST put_pinsrb(Location dst, Location src, Location imm); ///< Insert Byte
+			INST put_pinsrw(Location dst, Location src, Location imm); ///< Insert Word
+			INST put_pinsrd(Location dst, Location src, Location imm); ///< Insert Doubleword
+			INST put_pinsrq(Location dst, Location src, Location imm); ///< Insert Quadword
+
+			// avx
+			INST put_vzeroupper();                      ///< Zero Upper Bits of YMM Registers
+			INST put_vzeroall();                        ///< Zero All YMM Registers
+			INST put_vmovaps(Location dst, Location src); ///< Move Aligned Packed Single-Precision Floats
+			INST put_vmovups(Location dst, Location src); ///< Move Unaligned Packed Single-Precision Floats
+			INST put_vmovapd(Location dst, Location src); ///< Move Aligned Packed Double-Precision Floats
+			INST put_vmovupd(Location dst, Location src); ///< Move Unaligned Packed Double-Precision Floats
+			INST put_vmovdqa(Location dst, Location src); ///< Move Aligned Packed Integers
+			INST put_vmovdqu(Location dst, Location src); ///< Move Unaligned Packed Integers
+			INST put_vmovd(Location dst, Location src);   ///< Move Doubleword
+			INST put_vmovq(Location dst, Location src);   ///< Move Quadword
+			INST put_vpmovmskb(Location dst, Location src); ///< Move Byte Mask
+			INST put_vmovmskps(Location dst, Location src); ///< Extract Packed Single-Precision Float Sign Mask
+			INST put_vaddps(Location dst, Location src1, Location src2); ///< Add Packed Single-Precision Floats
+			INST put_vaddpd(Location dst, Location src1, Location src2); ///< Add Packed Double-Precision Floats
+			INST put_vaddss(Location dst, Location src1, Location src2); ///< Add Scalar Single-Precision Float
+			INST put_vaddsd(Location dst, Location src1, Location src2); ///< Add Scalar Double-Precision Float
+			INST put_vsubps(Location dst, Location src1, Location src2); ///< Subtract Packed Single-Precision Floats
+			INST put_vsubpd(Location dst, Location src1, Location src2); ///< Subtract Packed Double-Precision Floats
+			INST put_vsubss(Location dst, Location src1, Location src2); ///< Subtract Scalar Single-Precision Float
+			INST put_vsubsd(Location dst, Location src1, Location src2); ///< Subtract Scalar Double-Precision Float
+			INST put_vmulps(Location dst, Location src1, Location src2); ///< Multiply Packed Single-Precision Floats
+			INST put_vmulpd(Location dst, Location src1, Location src2); ///< Multiply Packed Double-Precision Floats
+			INST put_vmulss(Location dst, Location src1, Location src2); ///< Multiply Scalar Single-Precision Float
+			INST put_vmulsd(Location dst, Location src1, Location src2); ///< Multiply Scalar Double-Precision Float
+			INST put_vdivps(Location dst, Location src1, Location src2); ///< Divide Packed Single-Precision Floats
+			INST put_vdivpd(Location dst, Location src1, Location src2); ///< Divide Packed Double-Precision Floats
+			INST put_vdivss(Location dst, Location src1, Location src2); ///< Divide Scalar Single-Precision Float
+			INST put_vdivsd(Location dst, Location src1, Location src2); ///< Divide Scalar Double-Precision Float
+			INST put_vminps(Location dst, Location src1, Location src2); ///< Minimum of Packed Single-Precision Floats
+			INST put_vminpd(Location dst, Location src1, Location src2); ///< Minimum of Packed Double-Precision Floats
+			INST put_vminss(Location dst, Location src1, Location src2); ///< Minimum of Scalar Single-Precision Float
+			INST put_vminsd(Location dst, Location src1, Location src2); ///< Minimum of Scalar Double-Precision Float
+			INST put_vmaxps(Location dst, Location src1, Location src2); ///< Maximum of Packed Single-Precision Floats
+			INST put_vmaxpd(Location dst, Location src1, Location src2); ///< Maximum of Packed Double-Precision Floats
+			INST put_vmaxss(Location dst, Location src1, Location src2); ///< Maximum of Scalar Single-Precision Float
+			INST put_vmaxsd(Location dst, Location src1, Location src2); ///< Maximum of Scalar Double-Precision Float
+			INST put_vsqrtps(Location dst, Location src); ///< Square Root of Packed Single-Precision Floats
+			INST put_vsqrtpd(Location dst, Location src); ///< Square Root of Packed Double-Precision Floats
+			INST put_vsqrtss(Location dst, Location src1, Location src2); ///< Square Root of Scalar Single-Precision Float
+			INST put_vsqrtsd(Location dst, Location src1, Location src2); ///< Square Root of Scalar Double-Precision Float
+			INST put_vandps(Location dst, Location src1, Location src2); ///< Bitwise AND of Packed Single-Precision Floats
+			INST put_vandpd(Location dst, Location src1, Location src2); ///< Bitwise AND of Packed Double-Precision Floats
+			INST put_vandnps(Location dst, Location src1, Location src2); ///< Bitwise AND NOT of Packed Single-Precision Floats
+			INST put_vandnpd(Location dst, Location src1, Location src2); ///< Bitwise AND NOT of Packed Double-Precision Floats
+			INST put_vorps(Location dst, Location src1, Location src2); ///< Bitwise OR of Packed Single-Precision Floats
+			INST put_vorpd(Location dst, Location src1, Location src2); ///< Bitwise OR of Packed Double-Precision Floats
+			INST put_vxorps(Location dst, Location src1, Location src2); ///< Bitwise XOR of Packed Single-Precision Floats
+			INST put_vxorpd(Location dst, Location src1, Location src2); ///< Bitwise XOR of Packed Double-Precision Floats
+			INST put_vcmpps(Location dst, Location src1, Location src2, Location imm); ///< Compare Packed Single-Precision Floats, using the predicate given as immediate
+			INST put_vcmppd(Location dst, Location src1, Location src2, Location imm); ///< Compare Packed Double-Precision Floats, using the predicate given as immediate
+			INST put_vshufps(Location dst, Location src1, Location src2, Location imm); ///< Shuffle Packed Single-Precision Floats
+			INST put_vshufpd(Location dst, Location src1, Location src2, Location imm); ///< Shuffle Packed Double-Precision Floats
+			INST put_vcvtdq2ps(Location dst, Location src); ///< Convert Packed Doubleword Integers to Packed Single-Precision Floats
+			INST put_vcvtps2dq(Location dst, Location src); ///< Convert Packed Single-Precision Floats to Packed Doubleword Integers
+			INST put_vcvttps2dq(Location dst, Location src); ///< Convert with Truncation Packed Single-Precision Floats to Packed Doubleword Integers
+			INST put_vfmadd132ps(Location dst, Location src1, Location src2); ///< Fused Multiply-Add of Packed Single-Precision Floats, dst = dst * src2 + src1
+			INST put_vfmadd132pd(Location dst, Location src1, Location src2); ///< Fused Multiply-Add of Packed Double-Precision Floats, dst = dst * src2 + src1
+			INST put_vfmadd132ss(Location dst, Location src1, Location src2); ///< Fused Multiply-Add of Scalar Single-Precision Float, dst = dst * src2 + src1
+			INST put_vfmadd132sd(Location dst, Location src1, Location src2); ///< Fused Multiply-Add of Scalar Double-Precision Float, dst = dst * src2 + src1
+			INST put_vfmadd213ps(Location dst, Location src1, Location src2); ///< Fused Multiply-Add of Packed Single-Precision Floats, dst = src1 * dst + src2
+			INST put_vfmadd213pd(Location dst, Location src1, Location src2); ///< Fused Multiply-Add of Packed Double-Precision Floats, dst = src1 * dst + src2
+			INST put_vfmadd213ss(Location dst, Location src1, Location src2); ///< Fused Multiply-Add of Scalar Single-Precision Float, dst = src1 * dst + src2
+			INST put_vfmadd213sd(Location dst, Location src1, Location src2); ///< Fused Multiply-Add of Scalar Double-Precision Float, dst = src1 * dst + src2
+			INST put_vfmadd231ps(Location dst, Location src1, Location src2); ///< Fused Multiply-Add of Packed Single-Precision Floats, dst = src1 * src2 + dst
+			INST put_vfmadd231pd(Location dst, Location src1, Location src2); ///< Fused Multiply-Add of Packed Double-Precision Floats, dst = src1 * src2 + dst
+			INST put_vfmadd231ss(Location dst, Location src1, Location src2); ///< Fused Multiply-Add of Scalar Single-Precision Float, dst = src1 * src2 + dst
+			INST put_vfmadd231sd(Location dst, Location src1, Location src2); ///< Fused Multiply-Add of Scalar Double-Precision Float, dst = src1 * src2 + dst
+			INST put_vfmsub132ps(Location dst, Location src1, Location src2); ///< Fused Multiply-Subtract of Packed Single-Precision Floats, dst = dst * src2 - src1
+			INST put_vfmsub132pd(Location dst, Location src1, Location src2); ///< Fused Multiply-Subtract of Packed Double-Precision Floats, dst = dst * src2 - src1
+			INST put_vfmsub132ss(Location dst, Location src1, Location src2); ///< Fused Multiply-Subtract of Scalar Single-Precision Float, dst = dst * src2 - src1
+			INST put_vfmsub132sd(Location dst, Location src1, Location src2); ///< Fused Multiply-Subtract of Scalar Double-Precision Float, dst = dst * src2 - src1
+			INST put_vfmsub213ps(Location dst, Location src1, Location src2); ///< Fused Multiply-Subtract of Packed Single-Precision Floats, dst = src1 * dst - src2
+			INST put_vfmsub213pd(Location dst, Location src1, Location src2); ///< Fused Multiply-Subtract of Packed Double-Precision Floats, dst = src1 * dst - src2
+			INST put_vfmsub213ss(Location dst, Location src1, Location src2); ///< Fused Multiply-Subtract of Scalar Single-Precision Float, dst = src1 * dst - src2
+			INST put_vfmsub213sd(Location dst, Location src1, Location src2); ///< Fused Multiply-Subtract of Scalar Double-Precision Float, dst = src1 * dst - src2
+			INST put_vfmsub231ps(Location dst, Location src1, Location src2); ///< Fused Multiply-Subtract of Packed Single-Precision Floats, dst = src1 * src2 - dst
+			INST put_vfmsub231pd(Location dst, Location src1, Location src2); ///< Fused Multiply-Subtract of Packed Double-Precision Floats, dst = src1 * src2 - dst
+			INST put_vfmsub231ss(Location dst, Location src1, Location src2); ///< Fused Multiply-Subtract of Scalar Single-Precision Float, dst = src1 * src2 - dst
+			INST put_vfmsub231sd(Location dst, Location src1, Location src2); ///< Fused Multiply-Subtract of Scalar Double-Precision Float, dst = src1 * src2 - dst
+			INST put_vfnmadd132ps(Location dst, Location src1, Location src2); ///< Fused Negative Multiply-Add of Packed Single-Precision Floats, dst = -(dst * src2) + src1
+			INST put_vfnmadd132pd(Location dst, Location src1, Location src2); ///< Fused Negative Multiply-Add of Packed Double-Precision Floats, dst = -(dst * src2) + src1
+			INST put_vfnmadd132ss(Location dst, Location src1, Location src2); ///< Fused Negative Multiply-Add of Scalar Single-Precision Float, dst = -(dst * src2) + src1
+			INST put_vfnmadd132sd(Location dst, Location src1, Location src2); ///< Fused Negative Multiply-Add of Scalar Double-Precision Float, dst = -(dst * src2) + src1
+			INST put_vfnmadd213ps(Location dst, Location src1, Location src2); ///< Fused Negative Multiply-Add of Packed Single-Precision Floats, dst = -(src1 * dst) + src2
+			INST put_vfnmadd213pd(Location dst, Location src1, Location src2); ///< Fused Negative Multiply-Add of Packed Double-Precision Floats, dst = -(src1 * dst) + src2
+			INST put_vfnmadd213ss(Location dst, Location src1, Location src2); ///< Fused Negative Multiply-Add of Scalar Single-Precision Float, dst = -(src1 * dst) + src2
+			INST put_vfnmadd213sd(Location dst, Location src1, Location src2); ///< Fused Negative Multiply-Add of Scalar Double-Precision Float, dst = -(src1 * dst) + src2
+			INST put_vfnmadd231ps(Location dst, Location src1, Location src2); ///< Fused Negative Multiply-Add of Packed Single-Precision Floats, dst = -(src1 * src2) + dst
+			INST put_vfnmadd231pd(Location dst, Location src1, Location src2); ///< Fused Negative Multiply-Add of Packed Double-Precision Floats, dst = -(src1 * src2) + dst
+			INST put_vfnmadd231ss(Location dst, Location src1, Location src2); ///< Fused Negative Multiply-Add of Scalar Single-Precision Float, dst = -(src1 * src2) + dst
+			INST put_vfnmadd231sd(Location dst, Location src1, Location src2); ///< Fused Negative Multiply-Add of Scalar Double-Precision Float, dst = -(src1 * src2) + dst
+			INST put_vfnmsub132ps(Location dst, Location src1, Location src2); ///< Fused Negative Multiply-Subtract of Packed Single-Precision Floats, dst = -(dst * src2) - src1
+			INST put_vfnmsub132pd(Location dst, Location src1, Location src2); ///< Fused Negative Multiply-Subtract of Packed Double-Precision Floats, dst = -(dst * src2) - src1
+			INST put_vfnmsub132ss(Location dst, Location src1, Location src2); ///< Fused Negative Multiply-Subtract of Scalar Single-Precision Float, dst = -(dst * src2) - src1
+			INST put_vfnmsub132sd(Location dst, Location src1, Location src2); ///< Fused Negative Multiply-Subtract of Scalar Double-Precision Float, dst = -(dst * src2) - src1
+			INST put_vfnmsub213ps(Location dst, Location src1, Location src2); ///< Fused Negative Multiply-Subtract of Packed Single-Precision Floats, dst = -(src1 * dst) - src2
+			INST put_vfnmsub213pd(Location dst, Location src1, Location src2); ///< Fused Negative Multiply-Subtract of Packed Double-Precision Floats, dst = -(src1 * dst) - src2
+			INST put_vfnmsub213ss(Location dst, Location src1, Location src2); ///< Fused Negative Multiply-Subtract of Scalar Single-Precision Float, dst = -(src1 * dst) - src2
+			INST put_vfnmsub213sd(Location dst, Location src1, Location src2); ///< Fused Negative Multiply-Subtract of Scalar Double-Precision Float, dst = -(src1 * dst) - src2
+			INST put_vfnmsub231ps(Location dst, Location src1, Location src2); ///< Fused Negative Multiply-Subtract of Packed Single-Precision Floats, dst = -(src1 * src2) - dst
+			INST put_vfnmsub231pd(Location dst, Location src1, Location src2); ///< Fused Negative Multiply-Subtract of Packed Double-Precision Floats, dst = -(src1 * src2) - dst
+			INST put_vfnmsub231ss(Location dst, Location src1, Location src2); ///< Fused Negative Multiply-Subtract of Scalar Single-Precision Float, dst = -(src1 * src2) - dst
+			INST put_vfnmsub231sd(Location dst, Location src1, Location src2); ///< Fused Negative Multiply-Subtract of Scalar Double-Precision Float, dst = -(src1 * src2) - dst
+			INST put_vpaddb(Location dst, Location src1, Location src2); ///< Add Packed Byte Integers
+			INST put_vpaddw(Location dst, Location src1, Location src2); ///< Add Packed Word Integers
+			INST put_vpaddd(Location dst, Location src1, Location src2); ///< Add Packed Doubleword Integers
+			INST put_vpaddq(Location dst, Location src1, Location src2); ///< Add Packed Quadword Integers
+			INST put_vpsubb(Location dst, Location src1, Location src2); ///< Subtract Packed Byte Integers
+			INST put_vpsubw(Location dst, Location src1, Location src2); ///< Subtract Packed Word Integers
+			INST put_vpsubd(Location dst, Location src1, Location src2); ///< Subtract Packed Doubleword Integers
+			INST put_vpsubq(Location dst, Location src1, Location src2); ///< Subtract Packed Quadword Integers
+			INST put_vpmullw(Location dst, Location src1, Location src2); ///< Multiply Packed Word Integers and Store Low Result
+			INST put_vpmulld(Location dst, Location src1, Location src2); ///< Multiply Packed Doubleword Integers and Store Low Result
+			INST put_vpmuludq(Location dst, Location src1, Location src2); ///< Multiply Packed Unsigned Doubleword Integers into Quadwords
+			INST put_vpand(Location dst, Location src1, Location src2); ///< Bitwise AND
+			INST put_vpandn(Location dst, Location src1, Location src2); ///< Bitwise AND NOT
+			INST put_vpor(Location dst, Location src1, Location src2); ///< Bitwise OR
+			INST put_vpxor(Location dst, Location src1, Location src2); ///< Bitwise XOR
+			INST put_vpcmpeqb(Location dst, Location src1, Location src2); ///< Compare Packed Bytes for Equal
+			INST put_vpcmpeqw(Location dst, Location src1, Location src2); ///< Compare Packed Words for Equal
+			INST put_vpcmpeqd(Location dst, Location src1, Location src2); ///< Compare Packed Doublewords for Equal
+			INST put_vpcmpeqq(Location dst, Location src1, Location src2); ///< Compare Packed Quadwords for Equal
+			INST put_vpcmpgtb(Location dst, Location src1, Location src2); ///< Compare Packed Signed Bytes for Greater Than
+			INST put_vpcmpgtw(Location dst, Location src1, Location src2); ///< Compare Packed Signed Words for Greater Than
+			INST put_vpcmpgtd(Location dst, Location src1, Location src2); ///< Compare Packed Signed Doublewords for Greater Than
+			INST put_vpcmpgtq(Location dst, Location src1, Location src2); ///< Compare Packed Signed Quadwords for Greater Than
+			INST put_vpminub(Location dst, Location src1, Location src2); ///< Minimum of Packed Unsigned Bytes
+			INST put_vpmaxub(Location dst, Location src1, Location src2); ///< Maximum of Packed Unsigned Bytes
+			INST put_vpminsd(Location dst, Location src1, Location src2); ///< Minimum of Packed Signed Doublewords
+			INST put_vpmaxsd(Location dst, Location src1, Location src2); ///< Maximum of Packed Signed Doublewords
+			INST put_vpminud(Location dst, Location src1, Location src2); ///< Minimum of Packed Unsigned Doublewords
+			INST put_vpmaxud(Location dst, Location src1, Location src2); ///< Maximum of Packed Unsigned Doublewords
+			INST put_vpunpcklbw(Location dst, Location src1, Location src2); ///< Unpack and Interleave Low-Order Bytes
+			INST put_vpunpcklwd(Location dst, Location src1, Location src2); ///< Unpack and Interleave Low-Order Words
+			INST put_vpunpckldq(Location dst, Location src1, Location src2); ///< Unpack and Interleave Low-Order Doublewords
+			INST put_vpunpcklqdq(Location dst, Location src1, Location src2); ///< Unpack and Interleave Low-Order Quadwords
+			INST put_vpunpckhbw(Location dst, Location src1, Location src2); ///< Unpack and Interleave High-Order Bytes
+			INST put_vpunpckhwd(Location dst, Location src1, Location src2); ///< Unpack and Interleave High-Order Words
+			INST put_vpunpckhdq(Location dst, Location src1, Location src2); ///< Unpack and Interleave High-Order Doublewords
+			INST put_vpunpckhqdq(Location dst, Location src1, Location src2); ///< Unpack and Interleave High-Order Quadwords
+			INST put_vpacksswb(Location dst, Location src1, Location src2); ///< Pack Words into Bytes with Signed Saturation
+			INST put_vpackssdw(Location dst, Location src1, Location src2); ///< Pack Doublewords into Words with Signed Saturation
+			INST put_vpackuswb(Location dst, Location src1, Location src2); ///< Pack Words into Bytes with Unsigned Saturation
+			INST put_vpshufb(Location dst, Location src1, Location src2); ///< Shuffle Packed Bytes
+			INST put_vpsllvd(Location dst, Location src1, Location src2); ///< Variable Shift Packed Doublewords Left Logical
+			INST put_vpsllvq(Location dst, Location src1, Location src2); ///< Variable Shift Packed Quadwords Left Logical
+			INST put_vpsrlvd(Location dst, Location src1, Location src2); ///< Variable Shift Packed Doublewords Right Logical
+			INST put_vpsrlvq(Location dst, Location src1, Location src2); ///< Variable Shift Packed Quadwords Right Logical
+			INST put_vpsravd(Location dst, Location src1, Location src2); ///< Variable Shift Packed Doublewords Right Arithmetic
+			INST put_vpsllw(Location dst, Location src, Location cnt); ///< Shift Packed Words Left Logical
+			INST put_vpslld(Location dst, Location src, Location cnt); ///< Shift Packed Doublewords Left Logical
+			INST put_vpsllq(Location dst, Location src, Location cnt); ///< Shift Packed Quadwords Left Logical
+			INST put_vpsrlw(Location dst, Location src, Location cnt); ///< Shift Packed Words Right Logical
+			INST put_vpsrld(Location dst, Location src, Location cnt); ///< Shift Packed Doublewords Right Logical
+			INST put_vpsrlq(Location dst, Location src, Location cnt); ///< Shift Packed Quadwords Right Logical
+			INST put_vpsraw(Location dst, Location src, Location cnt); ///< Shift Packed Words Right Arithmetic
+			INST put_vpsrad(Location dst, Location src, Location cnt); ///< Shift Packed Doublewords Right Arithmetic
+			INST put_vpslldq(Location dst, Location src, Location cnt); ///< Shift Double Quadwords Left Logical, by bytes
+			INST put_vpsrldq(Location dst, Location src, Location cnt); ///< Shift Double Quadwords Right Logical, by bytes
+			INST put_vptest(Location dst, Location src); ///< Logical Compare and set ZF and CF
+			INST put_vpshufd(Location dst, Location src, Location imm); ///< Shuffle Packed Doublewords
+			INST put_vpshuflw(Location dst, Location src, Location imm); ///< Shuffle Packed Low Words
+			INST put_vpshufhw(Location dst, Location src, Location imm); ///< Shuffle Packed High Words
+			INST put_vpalignr(Location dst, Location src1, Location src2, Location imm); ///< Packed Align Right
+			INST put_vpblendd(Location dst, Location src1, Location src2, Location imm); ///< Blend Packed Doublewords
+			INST put_vpermd(Location dst, Location src1, Location src2); ///< Permute Doublewords, using the indices in src1
+			INST put_vpermps(Location dst, Location src1, Location src2); ///< Permute Single-Precision Floats, using the indices in src1
+			INST put_vpermq(Location dst, Location src, Location imm); ///< Permute Quadwords
+			INST put_vpermpd(Location dst, Location src, Location imm); ///< Permute Double-Precision Floats
+			INST put_vperm2i128(Location dst, Location src1, Location src2, Location imm); ///< Permute 128 bit Integer Lanes
+			INST put_vinserti128(Location dst, Location src1, Location src2, Location imm); ///< Insert 128 bit Integer Lane
+			INST put_vextracti128(Location dst, Location src, Location imm); ///< Extract 128 bit Integer Lane
+			INST put_vpbroadcastb(Location dst, Location src); ///< Broadcast Byte
+			INST put_vpbroadcastw(Location dst, Location src); ///< Broadcast Word
+			INST put_vpbroadcastd(Location dst, Location src); ///< Broadcast Doubleword
+			INST put_vpbroadcastq(Location dst, Location src); ///< Broadcast Quadword
+			INST put_vbroadcastss(Location dst, Location src); ///< Broadcast Single-Precision Float
+			INST put_vbroadcastsd(Location dst, Location src); ///< Broadcast Double-Precision Float
+			INST put_vbroadcasti128(Location dst, Location src); ///< Broadcast 128 bits of Integer Data
+			INST put_vpgatherdd(Location dst, Location src, Location mask); ///< Gather Doublewords using Doubleword Indices
+			INST put_vpgatherdq(Location dst, Location src, Location mask); ///< Gather Quadwords using Doubleword Indices
+			INST put_vpgatherqd(Location dst, Location src, Location mask); ///< Gather Doublewords using Quadword Indices
+			INST put_vpgatherqq(Location dst, Location src, Location mask); ///< Gather Quadwords using Quadword Indices
+			INST put_vgatherdps(Location dst, Location src, Location mask); ///< Gather Single-Precision Floats using Doubleword Indices
+			INST put_vgatherdpd(Location dst, Location src, Location mask); ///< Gather Double-Precision Floats using Doubleword Indices
+			INST put_vgatherqps(Location dst, Location src, Location mask); ///< Gather Single-Precision Floats using Quadword Indices
+			INST put_vgatherqpd(Location dst, Location src, Location mask); ///< Gather Double-Precision Floats using Quadword Indices
+
+			// avx-512
+			INST put_vmovdqa32(Location dst, Location src); ///< Move Aligned Packed Doublewords
+			INST put_vmovdqa64(Location dst, Location src); ///< Move Aligned Packed Quadwords
+			INST put_vmovdqu8(Location dst, Location src); ///< Move Unaligned Packed Bytes
+			INST put_vmovdqu16(Location dst, Location src); ///< Move Unaligned Packed Words
+			INST put_vmovdqu32(Location dst, Location src); ///< Move Unaligned Packed Doublewords
+			INST put_vmovdqu64(Location dst, Location src); ///< Move Unaligned Packed Quadwords
+			INST put_vpandd(Location dst, Location src1, Location src2); ///< Bitwise AND of Packed Doublewords
+			INST put_vpandq(Location dst, Location src1, Location src2); ///< Bitwise AND of Packed Quadwords
+			INST put_vpandnd(Location dst, Location src1, Location src2); ///< Bitwise AND NOT of Packed Doublewords
+			INST put_vpandnq(Location dst, Location src1, Location src2); ///< Bitwise AND NOT of Packed Quadwords
+			INST put_vpord(Location dst, Location src1, Location src2); ///< Bitwise OR of Packed Doublewords
+			INST put_vporq(Location dst, Location src1, Location src2); ///< Bitwise OR of Packed Quadwords
+			INST put_vpxord(Location dst, Location src1, Location src2); ///< Bitwise XOR of Packed Doublewords
+			INST put_vpxorq(Location dst, Location src1, Location src2); ///< Bitwise XOR of Packed Quadwords
+			INST put_vpternlogd(Location dst, Location src1, Location src2, Location imm); ///< Bitwise Ternary Logic of Packed Doublewords, the immediate is the truth table
+			INST put_vpternlogq(Location dst, Location src1, Location src2, Location imm); ///< Bitwise Ternary Logic of Packed Quadwords, the immediate is the truth table
+			INST put_vpcmpd(Location dst, Location src1, Location src2, Location imm); ///< Compare Packed Signed Doublewords into Mask
+			INST put_vpcmpud(Location dst, Location src1, Location src2, Location imm); ///< Compare Packed Unsigned Doublewords into Mask
+			INST put_vpcmpq(Location dst, Location src1, Location src2, Location imm); ///< Compare Packed Signed Quadwords into Mask
+			INST put_vpcmpuq(Location dst, Location src1, Location src2, Location imm); ///< Compare Packed Unsigned Quadwords into Mask
+			INST put_vptestmd(Location dst, Location src1, Location src2); ///< Logical AND of Packed Doublewords and Set Mask
+			INST put_vptestmq(Location dst, Location src1, Location src2); ///< Logical AND of Packed Quadwords and Set Mask
+			INST put_vptestnmd(Location dst, Location src1, Location src2); ///< Logical NAND of Packed Doublewords and Set Mask
+			INST put_vptestnmq(Location dst, Location src1, Location src2); ///< Logical NAND of Packed Quadwords and Set Mask
+			INST put_vpblendmd(Location dst, Location src1, Location src2); ///< Blend Packed Doublewords using an Opmask
+			INST put_vpblendmq(Location dst, Location src1, Location src2); ///< Blend Packed Quadwords using an Opmask
+			INST put_vblendmps(Location dst, Location src1, Location src2); ///< Blend Packed Single-Precision Floats using an Opmask
+			INST put_vblendmpd(Location dst, Location src1, Location src2); ///< Blend Packed Double-Precision Floats using an Opmask
+			INST put_vpcompressd(Location dst, Location src); ///< Store Sparse Packed Doublewords into Dense Memory
+			INST put_vpcompressq(Location dst, Location src); ///< Store Sparse Packed Quadwords into Dense Memory
+			INST put_vpexpandd(Location dst, Location src); ///< Load Sparse Packed Doublewords from Dense Memory
+			INST put_vpexpandq(Location dst, Location src); ///< Load Sparse Packed Quadwords from Dense Memory
+			INST put_vpminsq(Location dst, Location src1, Location src2); ///< Minimum of Packed Signed Quadwords
+			INST put_vpmaxsq(Location dst, Location src1, Location src2); ///< Maximum of Packed Signed Quadwords
+			INST put_vpminuq(Location dst, Location src1, Location src2); ///< Minimum of Packed Unsigned Quadwords
+			INST put_vpmaxuq(Location dst, Location src1, Location src2); ///< Maximum of Packed Unsigned Quadwords
+			INST put_vpmullq(Location dst, Location src1, Location src2); ///< Multiply Packed Quadwords and Store Low Result
+			INST put_vpsraq(Location dst, Location src, Location cnt); ///< Shift Packed Quadwords Right Arithmetic
+			INST put_kmovb(Location dst, Location src); ///< Move 8 bit Mask
+			INST put_kmovw(Location dst, Location src); ///< Move 16 bit Mask
+			INST put_kmovd(Location dst, Location src); ///< Move 32 bit Mask
+			INST put_kmovq(Location dst, Location src); ///< Move 64 bit Mask
+			INST put_kandb(Location dst, Location src1, Location src2); ///< Bitwise AND of 8 bit Masks
+			INST put_kandw(Location dst, Location src1, Location src2); ///< Bitwise AND of 16 bit Masks
+			INST put_kandd(Location dst, Location src1, Location src2); ///< Bitwise AND of 32 bit Masks
+			INST put_kandq(Location dst, Location src1, Location src2); ///< Bitwise AND of 64 bit Masks
+			INST put_kandnb(Location dst, Location src1, Location src2); ///< Bitwise AND NOT of 8 bit Masks
+			INST put_kandnw(Location dst, Location src1, Location src2); ///< Bitwise AND NOT of 16 bit Masks
+			INST put_kandnd(Location dst, Location src1, Location src2); ///< Bitwise AND NOT of 32 bit Masks
+			INST put_kandnq(Location dst, Location src1, Location src2); ///< Bitwise AND NOT of 64 bit Masks
+			INST put_korb(Location dst, Location src1, Location src2); ///< Bitwise OR of 8 bit Masks
+			INST put_korw(Location dst, Location src1, Location src2); ///< Bitwise OR of 16 bit Masks
+			INST put_kord(Location dst, Location src1, Location src2); ///< Bitwise OR of 32 bit Masks
+			INST put_korq(Location dst, Location src1, Location src2); ///< Bitwise OR of 64 bit Masks
+			INST put_kxnorb(Location dst, Location src1, Location src2); ///< Bitwise XNOR of 8 bit Masks
+			INST put_kxnorw(Location dst, Location src1, Location src2); ///< Bitwise XNOR of 16 bit Masks
+			INST put_kxnord(Location dst, Location src1, Location src2); ///< Bitwise XNOR of 32 bit Masks
+			INST put_kxnorq(Location dst, Location src1, Location src2); ///< Bitwise XNOR of 64 bit Masks
+			INST put_kxorb(Location dst, Location src1, Location src2); ///< Bitwise XOR of 8 bit Masks
+			INST put_kxorw(Location dst, Location src1, Location src2); ///< Bitwise XOR of 16 bit Masks
+			INST put_kxord(Location dst, Location src1, Location src2); ///< Bitwise XOR of 32 bit Masks
+			INST put_kxorq(Location dst, Location src1, Location src2); ///< Bitwise XOR of 64 bit Masks
+			INST put_knotb(Location dst, Location src); ///< Bitwise NOT of 8 bit Mask
+			INST put_knotw(Location dst, Location src); ///< Bitwise NOT of 16 bit Mask
+			INST put_knotd(Location dst, Location src); ///< Bitwise NOT of 32 bit Mask
+			INST put_knotq(Location dst, Location src); ///< Bitwise NOT of 64 bit Mask
+			INST put_kortestb(Location dst, Location src); ///< OR 8 bit Masks and Set Flags
+			INST put_kortestw(Location dst, Location src); ///< OR 16 bit Masks and Set Flags
+			INST put_kortestd(Location dst, Location src); ///< OR 32 bit Masks and Set Flags
+			INST put_kortestq(Location dst, Location src); ///< OR 64 bit Masks and Set Flags
+
 	};
 
 }
@@ -12,6 +12,8 @@
 #include <utility>
 #include <vector>
 #include <unordered_map>
+#include <map>
+#include <memory>
 #include <optional>
 #include <list>
 #include <functional>
@@ -26,6 +28,7 @@
 #	include <fcntl.h>
 #	include <sys/types.h>
 #	include <sys/mman.h>
+#	include <sys/stat.h>
 #	include <sys/wait.h>
 #else
 #	error "Non-linux platforms not yet suported!"
@@ -0,0 +1,265 @@
+
+#include "cache.hpp"
+#include "patch.hpp"
+
+#include <out/perf/perf.hpp>
+#include <out/debug/gdb.hpp>
+
+namespace asmio {
+
+	/*
+	 * class CodeBlock
+	 */
+
+	CodeBlock::CodeBlock(uint8_t* base, size_t length, LabelMap<size_t> labels)
+	: labels(std::move(labels)), base(base), length(length) {}
+
+	uint8_t* CodeBlock::address() const {
+		return base;
+	}
+
+	uint8_t* CodeBlock::address(const Label& label) const {
+		return base + labels.at(label);
+	}
+
+	size_t CodeBlock::size() const {
+		return length;
+	}
+
+	/*
+	 * struct CodeCacheStats
+	 */
+
+	double CodeCacheStats::fragmentation() const {
+		return free == 0 ? 0 : 1 - static_cast<double>(largest) / static_cast<double>(free);
+	}
+
+	/*
+	 * class CodeCache
+	 */
+
+	CodeCache::CodeCache(size_t capacity, size_t alignment)
+	: alignment(alignment) {
+
+		if (!std::has_single_bit(alignment)) {
+			throw std::runtime_error {"Code cache alignment must be a power of two!"};
+		}
+
+		length = util::align_up(capacity, static_cast<size_t>(getpagesize()));
+		fd = memfd_create("asmiov-code-cache", MFD_CLOEXEC);
+
+		if (fd == -1) {
+			throw std::runtime_error {"Failed to create code cache memory file!"};
+		}
+
+		if (ftruncate(fd, length) != 0) {
+			close(fd);
+			throw std::runtime_error {"Failed to resize code cache memory file!"};
+		}
+
+		void* rw = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		void* rx = mmap(nullptr, length, PROT_READ | PROT_EXEC, MAP_SHARED, fd, 0);
+
+		if (rw == MAP_FAILED || rx == MAP_FAILED) {
+			if (rw != MAP_FAILED) munmap(rw, length);
+			if (rx != MAP_FAILED) munmap(rx, length);
+
+			close(fd);
+			throw std::runtime_error {"Failed to map code cache memory file!"};
+		}
+
+		writable = static_cast<uint8_t*>(rw);
+		executable = static_cast<uint8_t*>(rx);
+		ranges.emplace(0, length);
+
+	}
+
+	CodeCache::CodeCache(CodeCache&& other) noexcept {
+		std::swap(fd, other.fd);
+		std::swap(writable, other.writable);
+		std::swap(executable, other.executable);
+		std::swap(length, other.length);
+		std::swap(alignment, other.alignment);
+		std::swap(used, other.used);
+		std::swap(ranges, other.ranges);
+		std::swap(symbols, other.symbols);
+	}
+
+	CodeCache::~CodeCache() {
+		symbols.clear();
+
+		if (writable != nullptr) {
+			munmap(writable, length);
+			munmap(executable, length);
+			close(fd);
+		}
+
+		writable = nullptr;
+		executable = nullptr;
+		fd = -1;
+	}
+
+	CodeCache& CodeCache::operator=(CodeCache&& other) noexcept {
+		std::swap(fd, other.fd);
+		std::swap(writable, other.writable);
+		std::swap(executable, other.executable);
+		std::swap(length, other.length);
+		std::swap(alignment, other.alignment);
+		std::swap(used, other.used);
+		std::swap(ranges, other.ranges);
+		std::swap(symbols, other.symbols);
+		return *this;
+	}
+
+	CodeBlock CodeCache::append(SegmentedBuffer& segmented) {
+
+		for (const BufferSegment& segment : segmented.segments()) {
+			if ((segment.flags & BufferSegment::W) && !(segment.flags & BufferSegment::X) && !segment.empty()) {
+				throw std::runtime_error {"Code cache can't hold writable segment '" + segment.name + "'!"};
+			}
+		}
+
+		// code aligned with BufferWriter::align() needs the block to start at a multiple of the same value,
+		// the views are only page aligned so that is the upper limit
+		const size_t required = std::max(alignment, segmented.get_alignment());
+
+		if (required > static_cast<size_t>(getpagesize())) {
+			throw std::runtime_error {"Code cache can't place a block at a multiple of " + std::to_string(required) + ", only up to the page size is supported!"};
+		}
+
+		// no need to pad to pages, the protection is the same for the whole cache,
+		// all ranges start and end aligned, as each block size is a multiple of the alignment
+		segmented.align(required);
+		const size_t total = segmented.total();
+
+		// the head of a free range is skipped if it is not aligned enough, it then stays free
+		auto it = std::find_if(ranges.begin(), ranges.end(), [&] (const auto& range) {
+			return range.second >= util::align_padding(range.first, required) + total;
+		});
+
+		if (it == ranges.end()) {
+			throw std::runtime_error {"Code cache is full, can't fit " + std::to_string(total) + " more bytes!"};
+		}
+
+		const auto [start, available] = *it;
+		const size_t offset = util::align_up(start, required);
+		const size_t skipped = offset - start;
+
+		// link against the executable view, but write through the writable one
+		segmented.link(reinterpret_cast<size_t>(executable + offset));
+
+		for (const BufferSegment& segment : segmented.segments()) {
+			uint8_t* data = writable + offset + segment.start;
+			const size_t bytes = segment.buffer.size();
+
+			memcpy(data, segment.buffer.data(), bytes);
+			memset(data + bytes, segment.padder, segment.tail);
+
+			// the slot could have held different code before, so flush it through the executable view
+			if (segment.flags & BufferSegment::X) {
+				flush_instructions(executable + offset + segment.start, bytes);
+			}
+		}
+
+		ranges.erase(it);
+
+		if (skipped > 0) {
+			ranges.emplace(start, skipped);
+		}
+
+		if (available > skipped + total) {
+			ranges.emplace(offset + total, available - skipped - total);
+		}
+
+		used += total;
+		perf_record(segmented, executable + offset);
+
+		if (auto file = gdb_record(segmented, executable + offset)) {
+			symbols[offset] = std::move(file);
+		}
+
+		return {executable + offset, total, segmented.resolved_labels()};
+
+	}
+
+	void CodeCache::release(const CodeBlock& block) {
+
+		if (block.size() == 0) {
+			return;
+		}
+
+		if (block.address() < executable || block.address() + block.size() > executable + length) {
+			throw std::runtime_error {"Can't release a block that is not part of this code cache!"};
+		}
+
+		size_t offset = block.address() - executable;
+		size_t size = block.size();
+
+		auto next = ranges.lower_bound(offset);
+
+		if (next != ranges.end() && next->first < offset + size) {
+			throw std::runtime_error {"Can't release a block that was already released!"};
+		}
+
+		// merge with the free ranges on both sides
+		if (next != ranges.begin()) {
+			auto previous = std::prev(next);
+
+			if (previous->first + previous->second > offset) {
+				throw std::runtime_error {"Can't release a block that was already released!"};
+			}
+
+			if (previous->first + previous->second == offset) {
+				offset = previous->first;
+				size += previous->second;
+				ranges.erase(previous);
+			}
+		}
+
+		if (next != ranges.end() && next->first == offset + size) {
+			size += next->second;
+			ranges.erase(next);
+		}
+
+		ranges.emplace(offset, size);
+		symbols.erase(block.address() - executable);
+		used -= block.size();
+
+	}
+
+	void CodeCache::patch(uint8_t* site, const uint8_t* target) {
+
+		if (site < executable || site >= executable + length) {
+			throw std::runtime_error {"Can't patch an instruction that is not part of this code cache!"};
+		}
+
+		patch_branch(site, writable + (site - executable), target);
+
+	}
+
+	uint8_t* CodeCache::address() const {
+		return executable;
+	}
+
+	size_t CodeCache::size() const {
+		return used;
+	}
+
+	size_t CodeCache::capacity() const {
+		return length;
+	}
+
+	CodeCacheStats CodeCache::stats() const {
+		CodeCacheStats stats;
+		stats.used = used;
+		stats.ranges = ranges.size();
+
+		for (const auto& [offset, size] : ranges) {
+			stats.free += size;
+			stats.largest = std::max(stats.largest, size);
+		}
+
+		return stats;
+	}
+
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "external.hpp"
+#include "segmented.hpp"
+#include "executable.hpp"
+#include "label.hpp"
+
+namespace asmio {
+
+	/// Code appended into a CodeCache, the addresses stay valid for as long as the cache lives
+	class CodeBlock {
+
+		private:
+
+			LabelMap<size_t> labels;
+			uint8_t* base = nullptr;
+			size_t length = 0;
+
+		public:
+
+			CodeBlock() = default;
+			CodeBlock(uint8_t* base, size_t length, LabelMap<size_t> labels);
+
+			/// Get the executable address of the first byte of this block
+			uint8_t* address() const;
+
+			/// Get the executable address of a specific label
+			uint8_t* address(const Label& label) const;
+
+			/// Get the total size, in bytes
+			size_t size() const;
+
+			/// Get a function pointer to the given label, see ExecutableBuffer::function()
+			template <native_function F>
+			F* function(const Label& label) const {
+				return reinterpret_cast<F*>(address(label));
+			}
+
+	};
+
+	/// Memory usage summary of a CodeCache
+	struct CodeCacheStats {
+
+		size_t used = 0;    ///< bytes held by live blocks
+		size_t free = 0;    ///< bytes not held by any block
+		size_t largest = 0; ///< size of the biggest free range, nothing bigger can be appended
+		size_t ranges = 0;  ///< number of separate free ranges
+
+		/// Fraction of the free space that is not part of the largest free range, zero when the free space is contiguous
+		double fragmentation() const;
+
+	};
+
+	/// Long-lived executable memory that can be appended to without changing the protection of any page,
+	/// the same memory file is mapped twice, once as writable and once as executable, so no page is ever both
+	class CodeCache {
+
+		private:
+
+			int fd = -1;
+			uint8_t* writable = nullptr;
+			uint8_t* executable = nullptr;
+			size_t length = 0;
+			size_t alignment = 0;
+			size_t used = 0;
+			std::map<size_t, size_t> ranges; // free ranges, from offset to size, never adjacent
+			std::unordered_map<size_t, std::unique_ptr<GdbSymbolFile>> symbols; // debugger symbols, by block offset
+
+		public:
+
+			/// Create a cache of at least 'capacity' bytes, each block placed in it will start at a multiple of 'alignment'
+			explicit CodeCache(size_t capacity, size_t alignment = 16);
+
+			CodeCache(CodeCache&& other) noexcept;
+			CodeCache(const CodeCache& other) = delete;
+			~CodeCache();
+
+			CodeCache& operator =(CodeCache&& other) noexcept;
+
+			/// Align, link and copy the given buffer into the first free range big enough to hold it, the code can be called right after this returns,
+			/// as nothing can be written through the executable view the write flag of executable segments is ignored and writable data segments are rejected,
+			/// the block is placed at a multiple of the largest alignment used by the buffer if it exceeds the cache alignment
+			CodeBlock append(SegmentedBuffer& segmented);
+
+			/// Return the space of an appended block to the cache so that it can be reused,
+			/// the block must not be executing or called again after this
+			void release(const CodeBlock& block);
+
+			/// Atomically retarget the call or jump instruction at the given executable address, see patch_branch(),
+			/// the instruction is written through the writable view, so it can be done at any time
+			void patch(uint8_t* site, const uint8_t* target);
+
+			/// Get the base address of the executable view
+			uint8_t* address() const;
+
+			/// Get the number of bytes held by live blocks
+			size_t size() const;
+
+			/// Get the total number of bytes that can be used
+			size_t capacity() const;
+
+			/// Get the memory usage summary
+			CodeCacheStats stats() const;
+
+	};
+
+}
@@ -1,5 +1,16 @@
 
 #include "executable.hpp"
+#include "patch.hpp"
+
+#include <cerrno>
+#include <out/perf/perf.hpp>
+#include <out/debug/gdb.hpp>
+
+// size of a transparent huge page on both x86-64 and aarch64 (with 4K base pages)
+#define HUGE_PAGE_SIZE (2 * 1024 * 1024)
+
+// protection of the pages that hold no baked segment, like the spare capacity
+#define UNUSED_PROTECTION PROT_WRITE
 
 namespace asmio {
 
@@ -7,75 +18,171 @@ namespace asmio {
 	 * ExecutableBuffer
 	 */
 
-	ExecutableBuffer::ExecutableBuffer(size_t total) {
+	void ExecutableBuffer::record(const SegmentedBuffer& segmented, size_t offset) {
+		perf_record(segmented, buffer + offset);
+
+		if (auto file = gdb_record(segmented, buffer + offset)) {
+			symbols.push_back(std::move(file));
+		}
+	}
+
+	void ExecutableBuffer::copy(SegmentedBuffer& segmented, size_t offset) {
+
+		// initialize pages
+		for (const BufferSegment& segment : segmented.segments()) {
+
+			uint8_t* data = buffer + offset + segment.start;
+			size_t bytes = segment.buffer.size();
 
-		const size_t page = getpagesize();
+			if (bytes == 0) {
+				continue;
+			}
+
+			memcpy(data, segment.buffer.data(), bytes);
+			memset(data + bytes, segment.padder, segment.tail);
+
+			// only the written bytes need to be flushed, and the pages are still readable here
+			if (segment.flags & BufferSegment::X) {
+				flush_instructions(data, bytes);
+			}
+
+			mprotect(data, segment.size(), segment.get_mprot_flags());
+			regions.emplace_back(offset + segment.start, segment.size(), segment.get_mprot_flags());
+		}
+
+	}
+
+	ExecutableBuffer::ExecutableBuffer() = default;
+
+	ExecutableBuffer::ExecutableBuffer(size_t total, size_t spare, bool huge_pages) {
+
+		page = huge_pages ? HUGE_PAGE_SIZE : getpagesize();
 
 		// this value should already be page aligned, but let's check anyway
-		length = util::align_up(total, page);
+		used = util::align_up(total, page);
+		length = used + util::align_up(spare, page);
+
+		// over-allocate so that the mapping can be trimmed to start at a huge page boundary
+		const size_t extra = huge_pages ? HUGE_PAGE_SIZE : 0;
 
 		// create a basic memory map, after this we will set the correct flags for each segment
-		buffer = (uint8_t*) mmap(nullptr, length, PROT_WRITE, MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+		void* mapping = mmap(nullptr, length + extra, UNUSED_PROTECTION, MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
 
-		if (buffer == nullptr) {
+		if (mapping == MAP_FAILED) {
 			throw std::runtime_error {"Failed to allocate memory map!"};
 		}
 
+		buffer = static_cast<uint8_t*>(mapping);
+
+		if (huge_pages) {
+			uint8_t* aligned = reinterpret_cast<uint8_t*>(util::align_up(reinterpret_cast<size_t>(buffer), static_cast<size_t>(HUGE_PAGE_SIZE)));
+			const size_t head = aligned - buffer;
+
+			if (head > 0) munmap(buffer, head);
+			if (extra > head) munmap(aligned + length, extra - head);
+
+			// if transparent huge pages are not supported this is just a slightly over-aligned buffer
+			buffer = aligned;
+			huge = madvise(buffer, length, MADV_HUGEPAGE) == 0;
+		}
+
 	}
 
 	ExecutableBuffer::ExecutableBuffer(ExecutableBuffer&& other) noexcept {
 		labels = std::move(other.labels);
+		regions = std::move(other.regions);
+		std::swap(symbols, other.symbols);
 
 		std::swap(buffer, other.buffer);
 		std::swap(length, other.length);
+		std::swap(used, other.used);
+		std::swap(page, other.page);
+		std::swap(huge, other.huge);
 	}
 
 	ExecutableBuffer::ExecutableBuffer(const ExecutableBuffer& other) {
 		labels = other.labels;
-		buffer = (uint8_t*) mmap(nullptr, other.length, PROT_WRITE, MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+		buffer = (uint8_t*) mmap(nullptr, other.length, UNUSED_PROTECTION, MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
 		length = other.length;
+		used = other.used;
+		page = getpagesize();
 	}
 
 	ExecutableBuffer::~ExecutableBuffer() {
+		// the debugger must forget the code before it is unmapped
+		symbols.clear();
+
 		if (buffer != nullptr) {
 			munmap(buffer, length);
 		}
 
 		buffer = nullptr;
 		length = 0;
+		used = 0;
 	}
 
 	ExecutableBuffer& ExecutableBuffer::operator=(ExecutableBuffer&& other) noexcept {
 		labels = std::move(other.labels);
+		regions = std::move(other.regions);
+		std::swap(symbols, other.symbols);
 
 		std::swap(buffer, other.buffer);
 		std::swap(length, other.length);
+		std::swap(used, other.used);
+		std::swap(page, other.page);
+		std::swap(huge, other.huge);
 		return *this;
 	}
 
 	void ExecutableBuffer::bake(SegmentedBuffer& segmented) {
 
-		if (segmented.total() != length) {
+		if (segmented.total() != used) {
 			throw std::runtime_error {"Invalid buffer size!"};
 		}
 
-		// initialize pages
-		for (const BufferSegment& segment : segmented.segments()) {
+		copy(segmented, 0);
+		record(segmented, 0);
 
-			uint8_t* data = buffer + segment.start;
-			size_t bytes = segment.buffer.size();
+		// copy the label map
+		labels = segmented.resolved_labels();
 
-			if (bytes == 0) {
-				continue;
+	}
+
+	void ExecutableBuffer::append(SegmentedBuffer& segmented) {
+
+		// only look up the labels the new code needs, not the whole map
+		for (const Label& label : segmented.undefined_labels()) {
+			auto it = labels.find(label);
+
+			if (it != labels.end()) {
+				segmented.add_import(label, reinterpret_cast<size_t>(buffer + it->second));
 			}
+		}
 
-			memcpy(data, segment.buffer.data(), bytes);
-			memset(data + bytes, segment.padder, segment.tail);
-			mprotect(data, segment.size(), segment.get_mprot_flags());
+		segmented.align(page);
+		const size_t total = segmented.total();
+
+		if (used + total > length) {
+			throw std::runtime_error {"Not enough spare capacity, " + std::to_string(total) + " bytes needed but only " + std::to_string(length - used) + " left!"};
 		}
 
-		// copy the label map
-		labels = segmented.resolved_labels();
+		LabelMap<size_t> added = segmented.resolved_labels();
+
+		for (const auto& [label, offset] : added) {
+			if (labels.contains(label)) {
+				throw std::runtime_error {"Can't redefine label '" + label.string() + "', it is already defined in the executable buffer"};
+			}
+		}
+
+		segmented.link(reinterpret_cast<size_t>(buffer + used));
+		copy(segmented, used);
+		record(segmented, used);
+
+		for (const auto& [label, offset] : added) {
+			labels.emplace(label, used + offset);
+		}
+
+		used += total;
 
 	}
 
@@ -88,20 +195,84 @@ namespace asmio {
 	}
 
 	size_t ExecutableBuffer::size() const {
+		return used;
+	}
+
+	size_t ExecutableBuffer::capacity() const {
 		return length;
 	}
 
+	bool ExecutableBuffer::has_huge_pages() const {
+		return huge;
+	}
+
+	void ExecutableBuffer::protect(size_t offset, size_t bytes, int flags) {
+		if (mprotect(buffer + offset, bytes, flags) != 0) {
+			throw std::runtime_error {"Failed to change the protection of executable memory, " + std::string {strerror(errno)}};
+		}
+	}
+
+	void ExecutableBuffer::patch(const Label& site, const uint8_t* target) {
+
+		uint8_t* pointer = address(site);
+
+		// the longest patchable instruction is 6 bytes long, and can cross into the next page
+		const size_t start = util::align_down(static_cast<size_t>(pointer - buffer), page);
+		const size_t end = std::min(util::align_up(static_cast<size_t>(pointer - buffer) + 6, page), length);
+
+		// adding the write permission doesn't affect threads executing this code,
+		// this fails if the system doesn't allow memory to be both writable and executable
+		protect(start, end - start, PROT_READ | PROT_WRITE | PROT_EXEC);
+
+		std::exception_ptr failure;
+
+		try {
+			patch_branch(pointer, pointer, target);
+		} catch (...) {
+			failure = std::current_exception();
+		}
+
+		// restore the whole range, the regions are ordered by offset and the pages between them are unused
+		size_t offset = start;
+
+		for (const Region& region : regions) {
+			const size_t from = std::max(start, region.start);
+			const size_t to = std::min(end, region.start + region.size);
+
+			if (from >= to) {
+				continue;
+			}
+
+			if (offset < from) {
+				protect(offset, from - offset, UNUSED_PROTECTION);
+			}
+
+			protect(from, to - from, region.flags);
+			offset = to;
+		}
+
+		if (offset < end) {
+			protect(offset, end - offset, UNUSED_PROTECTION);
+		}
+
+		if (failure) {
+			std::rethrow_exception(failure);
+		}
+
+	}
+
 	/*
 	 * Functions
 	 */
 
-	ExecutableBuffer to_executable(SegmentedBuffer& segmented) {
+	ExecutableBuffer to_executable(SegmentedBuffer& segmented, size_t spare, bool huge_pages) {
 
-		const size_t page = getpagesize();
+		// a huge page can only be used if all of it has the same protection
+		const size_t page = huge_pages ? HUGE_PAGE_SIZE : getpagesize();
 		segmented.align(page);
 
 		// after alignment we know how big the buffer needs to be
-		ExecutableBuffer buffer {segmented.total()};
+		ExecutableBuffer buffer {segmented.total(), spare, huge_pages};
 
 		// now that we have a buffer allocated we can link
 		segmented.link((uint64_t) buffer.address());
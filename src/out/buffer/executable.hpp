@@ -21,18 +21,56 @@ namespace asmio {
 	template <typename T>
 	concept integral_or_void = std::is_integral_v<T> || std::is_void_v<T>;
 
+	/// Values that the SysV x86-64 and AAPCS64 calling conventions pass in a single general purpose or vector register,
+	/// the x87 'long double' is passed in memory and returned in st0 on x86-64, so it is excluded there
+	template <typename T>
+	concept register_passed = (std::is_arithmetic_v<T> && !(ARCH_X86 && std::is_same_v<std::remove_cv_t<T>, long double>)) || std::is_pointer_v<T>;
+
+	template <typename F>
+	struct native_signature : std::false_type {};
+
+	template <typename R, register_passed... Args> requires register_passed<R> || std::is_void_v<R>
+	struct native_signature<R(Args...)> : std::true_type {};
+
+	/// Function type that can be called directly with all arguments and the result in registers, for example 'int(int, double*)'
+	template <typename F>
+	concept native_function = native_signature<F>::value;
+
+	class GdbSymbolFile;
+
 	class ExecutableBuffer {
 
 		private:
 
+			/// Protection of a baked segment, used to restore it after patching
+			struct Region {
+				size_t start;
+				size_t size;
+				int flags;
+			};
+
+			std::vector<Region> regions;
+			std::vector<std::unique_ptr<GdbSymbolFile>> symbols;
 			LabelMap<size_t> labels;
 			uint8_t* buffer = nullptr;
 			size_t length = 0;
+			size_t used = 0;
+			size_t page = 0;
+			bool huge = false;
+
+			/// Change the protection of a page aligned range of the buffer, throws on failure
+			void protect(size_t offset, size_t bytes, int flags);
+
+			/// Copy the segments into the buffer at the given offset and protect them
+			void copy(SegmentedBuffer& segmented, size_t offset);
+
+			/// Describe the code copied at the given offset to profilers and debuggers
+			void record(const SegmentedBuffer& segmented, size_t offset);
 
 		public:
 
-			ExecutableBuffer() = default;
-			explicit ExecutableBuffer(size_t total);
+			ExecutableBuffer();
+			explicit ExecutableBuffer(size_t total, size_t spare = 0, bool huge_pages = false);
 
 			ExecutableBuffer(ExecutableBuffer&& other) noexcept;
 			explicit ExecutableBuffer(const ExecutableBuffer& other);
@@ -43,17 +81,45 @@ namespace asmio {
 			/// Copy data from segmented buffer and configure memory protection
 			void bake(SegmentedBuffer& segmented);
 
+			/// Link the given buffer against the labels of this one and place it into the spare capacity,
+			/// only the new code is linked and copied, the labels it defines can then be used in the same way as the baked ones
+			void append(SegmentedBuffer& segmented);
+
 			/// Get the base address of this buffer
 			uint8_t* address() const;
 
 			/// Get the address of a specific label
 			uint8_t* address(Label label) const;
 
-			/// get the total size, in bytes
+			/// Get the total size of the baked and appended code, in bytes
 			size_t size() const;
 
+			/// Get the total size including the spare capacity, in bytes
+			size_t capacity() const;
+
+			/// Check if the kernel was asked to back this buffer with transparent huge pages
+			bool has_huge_pages() const;
+
+			/// Atomically retarget the call or jump instruction placed right after the 'site' label, see patch_branch(),
+			/// the pages holding the instruction are briefly made both writable and executable, use CodeCache to avoid that,
+			/// throws if the system refuses such mapping, the original protection is restored even if the patch fails
+			void patch(const Label& site, const uint8_t* target);
+
 		public:
 
+			/// Get a function pointer to the given offset, the code needs to follow the calling convention of the platform,
+			/// calling it has no overhead compared to calling a normal function, unlike scall()
+			template <native_function F>
+			F* function(size_t offset = 0) const {
+				return reinterpret_cast<F*>(buffer + offset);
+			}
+
+			/// Get a function pointer to the given label, see function(size_t)
+			template <native_function F>
+			F* function(const Label& label) const {
+				return function<F>(labels.at(label));
+			}
+
 			template <integral_or_void R, trivially_copyable... Args>
 			R scall(size_t offset, Args... args) {
 
@@ -146,7 +212,8 @@ namespace asmio {
 
 	};
 
-	/// Create an ExecutableBuffer given a SegmentedBuffer
-	ExecutableBuffer to_executable(SegmentedBuffer& segmented);
+	/// Create an ExecutableBuffer given a SegmentedBuffer, with 'spare' bytes left for ExecutableBuffer::append(),
+	/// with 'huge_pages' set the segments are aligned to 2 MiB and the buffer is backed by transparent huge pages when the system allows it
+	ExecutableBuffer to_executable(SegmentedBuffer& segmented, size_t spare = 0, bool huge_pages = false);
 
 }
@@ -57,6 +57,11 @@ namespace asmio {
 				return hash == 0;
 			}
 
+			/// Get the identifier of a label created with make_unique(), or zero for any other label
+			constexpr uint64_t identifier() const {
+				return (is_text() || empty()) ? 0 : id;
+			}
+
 			constexpr Label()
 				: id(0), allocated(false), length(0), hash(0) {
 			}
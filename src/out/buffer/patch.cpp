@@ -0,0 +1,93 @@
+
+#include "patch.hpp"
+
+#include <util.hpp>
+
+namespace asmio {
+
+	/// Replace 'bytes' (at most 4) bytes at 'pointer' with a single atomic store,
+	/// the store is widened to the aligned 8 byte word if the bytes are not naturally aligned
+	static void store_atomic(uint8_t* pointer, const void* value, size_t bytes) {
+
+		if (bytes == 4 && reinterpret_cast<size_t>(pointer) % 4 == 0) {
+			uint32_t word;
+			memcpy(&word, value, 4);
+			__atomic_store_n(reinterpret_cast<uint32_t*>(pointer), word, __ATOMIC_RELEASE);
+			return;
+		}
+
+		const size_t address = reinterpret_cast<size_t>(pointer);
+		const size_t shift = address % 8;
+
+		if (shift + bytes > 8) {
+			throw std::runtime_error {"Can't atomically patch " + std::to_string(bytes) + " bytes at " + util::to_hex(address) + ", they cross an 8 byte boundary!"};
+		}
+
+		auto* aligned = reinterpret_cast<uint64_t*>(address - shift);
+		uint64_t expected = __atomic_load_n(aligned, __ATOMIC_RELAXED);
+		uint64_t desired;
+
+		do {
+			desired = expected;
+			memcpy(reinterpret_cast<uint8_t*>(&desired) + shift, value, bytes);
+		} while (!__atomic_compare_exchange_n(aligned, &expected, desired, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+
+	}
+
+	void flush_instructions(const uint8_t* begin, size_t bytes) {
+
+#if ARCH_AARCH64
+		// expands to 'dc cvau' and 'ic ivau' over all cache lines in the range, followed by the required barriers
+		char* pointer = reinterpret_cast<char*>(const_cast<uint8_t*>(begin));
+		__builtin___clear_cache(pointer, pointer + bytes);
+#endif
+
+	}
+
+	void patch_branch(uint8_t* site, uint8_t* writable, const uint8_t* target) {
+
+#if ARCH_X86
+		// call rel32 and jmp rel32 have a one byte opcode, jcc rel32 has two
+		size_t opcode;
+
+		if (site[0] == 0xE8 || site[0] == 0xE9) {
+			opcode = 1;
+		} else if (site[0] == 0x0F && (site[1] & 0xF0) == 0x80) {
+			opcode = 2;
+		} else {
+			throw std::runtime_error {"Can't patch instruction at " + util::to_hex(reinterpret_cast<size_t>(site)) + ", it is not a call or jump with 32 bit displacement!"};
+		}
+
+		const int64_t displacement = target - (site + opcode + 4);
+
+		if (!util::is_signed_encodable(displacement, 32)) {
+			throw std::runtime_error {"Can't patch branch at " + util::to_hex(reinterpret_cast<size_t>(site)) + ", target is too far!"};
+		}
+
+		const int32_t value = static_cast<int32_t>(displacement);
+		store_atomic(writable + opcode, &value, 4);
+#elif ARCH_AARCH64
+		const uint32_t instruction = *reinterpret_cast<uint32_t*>(site);
+		const uint32_t opcode = instruction & 0xFC000000;
+
+		// b imm26 and bl imm26
+		if (opcode != 0x14000000 && opcode != 0x94000000) {
+			throw std::runtime_error {"Can't patch instruction at " + util::to_hex(reinterpret_cast<size_t>(site)) + ", it is not a B or BL!"};
+		}
+
+		const int64_t displacement = target - site;
+
+		if ((displacement & 0b11) || !util::is_signed_encodable(displacement >> 2, 26)) {
+			throw std::runtime_error {"Can't patch branch at " + util::to_hex(reinterpret_cast<size_t>(site)) + ", target is too far or unaligned!"};
+		}
+
+		const uint32_t value = opcode | (util::bit_fill<uint32_t>(26) & (displacement >> 2));
+		store_atomic(writable, &value, 4);
+#endif
+
+		// make sure the new instruction is seen by the instruction fetch
+		flush_instructions(site, 4);
+
+	}
+
+}
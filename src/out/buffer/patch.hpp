@@ -0,0 +1,18 @@
+#pragma once
+
+#include "external.hpp"
+
+namespace asmio {
+
+	/// Make sure that code written to the given range will be seen by the instruction fetch of all cores, needs to be called
+	/// after writing code and before running it, on aarch64 this cleans the data cache and invalidates the instruction cache, on x86 it does nothing
+	void flush_instructions(const uint8_t* begin, size_t bytes);
+
+	/// Atomically retarget the relative call or jump at 'site' to 'target', so that it can be done while other threads execute it,
+	/// the new displacement is written through 'writable', which needs to be a writable view of the memory at 'site' (possibly the same address),
+	/// supported are x86 'call/jmp/jcc rel32' whose displacement does not cross an 8 byte boundary, and aarch64 'b/bl imm26',
+	/// on x86 writing the site with BasicBufferWriter::align(8) placed in front of it guarantees that, as the displacement then starts
+	/// at most 2 bytes into an aligned qword, also note that jumps written with relaxation enabled can end up in the unpatchable short form
+	void patch_branch(uint8_t* site, uint8_t* writable, const uint8_t* target);
+
+}
@@ -2,6 +2,14 @@
 #include "segmented.hpp"
 
 #include <utility>
+#include <thread>
+
+// minimal number of linkages given to each link worker
+#define LINK_BATCH 4096
+
+// section of labels that were referenced but not yet defined
+#define UNDEFINED_SECTION UINT32_MAX
+#define IMPORTED_SECTION (UINT32_MAX - 1)
 
 namespace asmio {
 
@@ -85,44 +93,498 @@ namespace asmio {
 	void SegmentedBuffer::align(size_t page) {
 		size_t offset = 0;
 
+		// sizes can't change after this point
+		relax();
+
 		// align sections to page boundaries
 		for (BufferSegment& segment : sections) {
 			offset = segment.align(offset, page);
 		}
 	}
 
+	void SegmentedBuffer::set_relaxation(bool enable) {
+		relaxing = enable;
+	}
+
+	bool SegmentedBuffer::has_relaxation() const {
+		return relaxing;
+	}
+
+	void SegmentedBuffer::add_relaxation(uint8_t length, std::initializer_list<uint8_t> grown, uint8_t width) {
+		Relaxation& relaxation = relaxations.emplace_back();
+		BufferMarker marker = current();
+
+		relaxation.start = {marker.section, marker.offset - length};
+		relaxation.linkage = linkages.size() - 1;
+		relaxation.length = length;
+		relaxation.width = width;
+		relaxation.size = grown.size();
+
+		std::copy(grown.begin(), grown.end(), relaxation.grown.begin());
+	}
+
+	void SegmentedBuffer::pad(size_t alignment, Padding::Filler filler) {
+
+		if (!std::has_single_bit(alignment)) {
+			throw std::runtime_error {"Invalid alignment " + std::to_string(alignment) + ", expected a power of two!"};
+		}
+
+		auto& buffer = sections[selected].buffer;
+		const size_t offset = buffer.size();
+		const size_t bytes = util::align_padding(offset, alignment);
+
+		buffer.resize(offset + bytes, 0);
+
+		if (filler) {
+			filler(buffer.data() + offset, bytes);
+		}
+
+		// jumps in front of the padding can still be grown, then it will need to be resized
+		paddings.emplace_back(BufferMarker {(uint32_t) selected, (uint32_t) offset}, bytes, alignment, filler);
+		padded = std::max(padded, alignment);
+	}
+
+	size_t SegmentedBuffer::get_alignment() const {
+		return padded;
+	}
+
+	size_t SegmentedBuffer::relax() {
+
+		if (relaxations.empty()) {
+			paddings.clear();
+			return 0;
+		}
+
+		const size_t count = relaxations.size();
+
+		// relaxations and paddings in each section, in the order of increasing offsets,
+		// paddings are given the indices after the relaxations, starting at 'count'
+		std::vector<std::vector<uint32_t>> ordered {sections.size()};
+
+		for (uint32_t i = 0; i < count; i ++) {
+			ordered[relaxations[i].start.section].push_back(i);
+		}
+
+		for (uint32_t i = 0; i < paddings.size(); i ++) {
+			ordered[paddings[i].start.section].push_back(count + i);
+		}
+
+		// a position is after a jump if it is past its first byte, and after a padding if it is at or past its end,
+		// so a label placed right after an empty padding moves together with it, the ordering key encodes exactly that
+		auto key = [&] (uint32_t index) noexcept -> uint64_t {
+			if (index < count) {
+				return relaxations[index].start.offset * 2ull + 1;
+			}
+
+			const Padding& padding = paddings[index - count];
+			return (padding.start.offset + padding.length) * 2ull;
+		};
+
+		for (std::vector<uint32_t>& list : ordered) {
+			std::ranges::stable_sort(list, std::less {}, key);
+		}
+
+		// label targets don't change during the search, only the jumps between them grow
+		std::vector<std::optional<BufferMarker>> targets;
+		targets.reserve(count);
+
+		for (const Relaxation& relaxation : relaxations) {
+			const BufferMarker position = positions[linkages[relaxation.linkage].label];
+			targets.push_back(position.section == UNDEFINED_SECTION ? std::nullopt : std::optional {position});
+		}
+
+		// all jumps start short, and once a jump is grown it is never shrunk back,
+		// so this loop will stop after at most 'count' iterations
+		std::vector<bool> grown (count, false);
+		std::vector<int64_t> before (count + paddings.size(), 0);
+		std::vector<int64_t> totals (sections.size(), 0);
+		std::vector<uint32_t> lengths (paddings.size(), 0);
+
+		// computes how many bytes were added in front of the given position
+		auto shift = [&] (BufferMarker marker) noexcept -> int64_t {
+			const std::vector<uint32_t>& list = ordered[marker.section];
+			auto it = std::ranges::lower_bound(list, marker.offset * 2ull + 1, std::less {}, key);
+			return (it == list.end()) ? totals[marker.section] : before[*it];
+		};
+
+		for (bool changed = true; changed;) {
+			changed = false;
+
+			for (size_t section = 0; section < ordered.size(); section ++) {
+				int64_t total = 0;
+
+				for (uint32_t index : ordered[section]) {
+					before[index] = total;
+
+					if (index < count) {
+						const Relaxation& relaxation = relaxations[index];
+						if (grown[index]) total += relaxation.size - relaxation.length;
+						continue;
+					}
+
+					// the moved padding needs to end at the next multiple of its alignment
+					const Padding& padding = paddings[index - count];
+					const uint32_t length = util::align_padding<uint64_t>(padding.start.offset + total, padding.alignment);
+
+					lengths[index - count] = length;
+					total += static_cast<int64_t>(length) - padding.length;
+				}
+
+				totals[section] = total;
+			}
+
+			for (uint32_t i = 0; i < count; i ++) {
+				if (grown[i] || !targets[i].has_value()) {
+					continue;
+				}
+
+				const Relaxation& relaxation = relaxations[i];
+				const BufferMarker target = targets[i].value();
+
+				// distance between sections is only known once they are aligned
+				if (target.section != relaxation.start.section) {
+					grown[i] = changed = true;
+					continue;
+				}
+
+				// same as what the linker would compute, using the moved positions
+				const Linkage& linkage = linkages[relaxation.linkage];
+				const int64_t displacement = target.offset + shift(target) - (linkage.target.offset + before[i]) + linkage.addend;
+
+				if (displacement < INT8_MIN || displacement > INT8_MAX) {
+					grown[i] = changed = true;
+				}
+			}
+		}
+
+		// move the code to make space for the grown jumps, nothing moves in sections without them
+		for (size_t section = 0; section < ordered.size(); section ++) {
+			const std::vector<uint32_t>& list = ordered[section];
+
+			if (std::ranges::none_of(list, [&] (uint32_t index) noexcept { return index < count && grown[index]; })) {
+				continue;
+			}
+
+			std::vector<uint8_t>& buffer = sections[section].buffer;
+			std::vector<uint8_t> moved;
+			moved.reserve(buffer.size() + std::max<int64_t>(totals[section], 0));
+
+			size_t copied = 0;
+
+			for (uint32_t index : list) {
+				if (index >= count) {
+					const Padding& padding = paddings[index - count];
+					const size_t length = lengths[index - count];
+					moved.insert(moved.end(), buffer.begin() + copied, buffer.begin() + padding.start.offset);
+
+					const size_t offset = moved.size();
+					moved.resize(offset + length, 0);
+
+					if (padding.filler) {
+						padding.filler(moved.data() + offset, length);
+					}
+
+					copied = padding.start.offset + padding.length;
+					continue;
+				}
+
+				if (!grown[index]) {
+					continue;
+				}
+
+				const Relaxation& relaxation = relaxations[index];
+				moved.insert(moved.end(), buffer.begin() + copied, buffer.begin() + relaxation.start.offset);
+				moved.insert(moved.end(), relaxation.grown.begin(), relaxation.grown.begin() + relaxation.size);
+				copied = relaxation.start.offset + relaxation.length;
+			}
+
+			moved.insert(moved.end(), buffer.begin() + copied, buffer.end());
+			buffer = std::move(moved);
+		}
+
+		// explicit export sizes span the code after the label, which grows together with the jumps inside it
+		for (ExportSymbol& symbol : exported_symbols) {
+			const int64_t handle = find_handle(symbol.label);
+
+			if (symbol.size == 0 || handle < 0 || positions[handle].section >= IMPORTED_SECTION) {
+				continue;
+			}
+
+			const BufferMarker start = positions[handle];
+			const BufferMarker end {start.section, static_cast<uint32_t>(start.offset + symbol.size)};
+			symbol.size += shift(end) - shift(start);
+		}
+
+		for (BufferMarker& marker : positions) {
+			if (marker.section < IMPORTED_SECTION) {
+				marker.offset += shift(marker);
+			}
+		}
+
+		for (Linkage& linkage : linkages) {
+			linkage.target.offset += shift(linkage.target);
+		}
+
+		// replace the short displacements of grown jumps
+		size_t saved = 0;
+
+		for (uint32_t i = 0; i < count; i ++) {
+			const Relaxation& relaxation = relaxations[i];
+
+			if (!grown[i]) {
+				saved += relaxation.size - relaxation.length;
+				continue;
+			}
+
+			// the short displacement was one byte wide, and the long one is still measured from the end of the instruction
+			Linkage& linkage = linkages[relaxation.linkage];
+			linkage.target = {relaxation.start.section, static_cast<uint32_t>(relaxation.start.offset + before[i] + relaxation.size - relaxation.width)};
+			linkage.addend += 1 - relaxation.width;
+			linkage.width = relaxation.width;
+		}
+
+		relaxations.clear();
+		paddings.clear();
+		return saved;
+
+	}
+
 	void SegmentedBuffer::link(size_t base, const Linkage::Handler& handler) {
 		base_address = base;
 
-		for (const Linkage& linkage : linkages) {
-			try {
-				linkage.linker(this, linkage, base);
-			} catch (std::runtime_error& error) {
-				if (handler) handler(linkage, error.what()); else throw;
+		const size_t count = linkages.size();
+		const size_t workers = std::min(link_workers, count / LINK_BATCH + 1);
+
+		if (workers <= 1) {
+			for (const Linkage& linkage : linkages) {
+				try {
+					apply(linkage, base);
+				} catch (std::runtime_error& error) {
+					if (handler) handler(linkage, error.what()); else throw;
+				}
 			}
+
+			return;
+		}
+
+		// once aligned the linkages are independent, so each worker can take a contiguous slice,
+		// errors are collected and only reported after all workers finish to keep their order
+		std::vector<std::vector<std::pair<size_t, std::string>>> errors {workers};
+		std::vector<std::exception_ptr> failures {workers};
+		std::vector<std::thread> threads;
+		threads.reserve(workers);
+
+		for (size_t worker = 0; worker < workers; worker ++) {
+			threads.emplace_back([this, base, count, workers, worker, &errors, &failures] () {
+				const size_t end = count * (worker + 1) / workers;
+
+				for (size_t i = count * worker / workers; i < end; i ++) {
+					try {
+						apply(linkages[i], base);
+					} catch (std::runtime_error& error) {
+						errors[worker].emplace_back(i, error.what());
+					} catch (...) {
+						failures[worker] = std::current_exception();
+						return;
+					}
+				}
+			});
 		}
+
+		for (std::thread& thread : threads) {
+			thread.join();
+		}
+
+		for (size_t worker = 0; worker < workers; worker ++) {
+			for (const auto& [index, what] : errors[worker]) {
+				if (handler) handler(linkages[index], what.c_str()); else throw std::runtime_error {what};
+			}
+
+			// any other exception stops the worker, just like it would stop the serial loop
+			if (failures[worker]) {
+				std::rethrow_exception(failures[worker]);
+			}
+		}
+	}
+
+	void SegmentedBuffer::set_link_workers(size_t workers) {
+		link_workers = (workers == 0) ? std::max(1u, std::thread::hardware_concurrency()) : workers;
+	}
+
+	void SegmentedBuffer::apply(const Linkage& linkage, size_t mount) {
+
+		const BufferMarker dst = linkage.target;
+		const BufferMarker position = get_position(linkage.label);
+
+		// imported labels are given as absolute addresses, make them relative to the mount point like all the others
+		const int64_t offset = (position.section == IMPORTED_SECTION)
+			? static_cast<int64_t>(imports[position.offset] - mount)
+			: get_offset(position);
+
+		const Label& label = names[linkage.label];
+		uint8_t* pointer = get_pointer(dst);
+
+		switch (linkage.kind) {
+
+			case Linkage::RELATIVE:
+			case Linkage::ABSOLUTE: {
+				const int64_t value = (linkage.kind == Linkage::RELATIVE)
+					? offset - get_offset(dst) + linkage.addend
+					: offset + mount + linkage.addend;
+
+				if (util::min_sign_extended_bytes(value) > linkage.width) {
+					throw std::runtime_error {"Can't fit label '" + label.string() + "' (" + util::to_hex(value) + ") into target of size " + std::to_string(linkage.width) + ", some data would have been truncated!"};
+				}
+
+				memcpy(pointer, &value, linkage.width);
+				return;
+			}
+
+			case Linkage::ALIGNED: {
+				const int64_t distance = offset - get_offset(dst) + linkage.addend;
+
+				if (distance & 0b11) {
+					throw std::runtime_error {"Can't reference label '" + label.string() + "' (offset " + util::to_hex(distance) + ") into target " + util::to_hex(dst.offset) + ", offset is not aligned!"};
+				}
+
+				if (!util::is_signed_encodable(distance >> 2, linkage.width)) {
+					throw std::runtime_error {"Can't fit label '" + label.string() + "' (offset " + util::to_hex(distance) + ") into target " + util::to_hex(dst.offset) + ", some data would have been truncated!"};
+				}
+
+				*reinterpret_cast<uint32_t*>(pointer) |= ((util::bit_fill<uint64_t>(linkage.width) & (distance >> 2)) << linkage.bit);
+				return;
+			}
+
+			case Linkage::LO_HI: {
+				const int64_t distance = offset - get_offset(dst) + linkage.addend;
+
+				if (!util::is_signed_encodable(distance, 21)) {
+					throw std::runtime_error {"Can't fit label '" + label.string() + "' (offset " + util::to_hex(distance) + ") into target " + util::to_hex(dst.offset) + ", some data would have been truncated!"};
+				}
+
+				const uint64_t masked = util::bit_fill<uint64_t>(21) & distance;
+				const uint32_t immlo = masked & 0b11;
+				const uint32_t immhi = masked >> 2;
+
+				*reinterpret_cast<uint32_t*>(pointer) |= (immlo << 29 | immhi << 5);
+				return;
+			}
+
+			case Linkage::CUSTOM:
+				linkage.linker(this, linkage, mount);
+				return;
+
+		}
+
+	}
+
+	void SegmentedBuffer::add_linkage(const Label& label, int shift, Linkage::Kind kind, uint8_t width, int32_t addend, uint8_t bit) {
+		uint32_t offset = sections[selected].buffer.size();
+		Linkage& linkage = linkages.emplace_back(get_handle(label), BufferMarker {(uint32_t) selected, offset + shift});
+
+		linkage.kind = kind;
+		linkage.width = width;
+		linkage.addend = addend;
+		linkage.bit = bit;
 	}
 
-	void SegmentedBuffer::add_linkage(const Label& label, int shift, const Linkage::Linker& linker) {
+	void SegmentedBuffer::add_linkage(const Label& label, int shift, Linkage::Linker linker) {
 		uint32_t offset = sections[selected].buffer.size();
-		linkages.emplace_back(label, BufferMarker {(uint32_t) selected, offset + shift}, linker);
+		Linkage& linkage = linkages.emplace_back(get_handle(label), BufferMarker {(uint32_t) selected, offset + shift});
+
+		linkage.kind = Linkage::CUSTOM;
+		linkage.linker = linker;
+	}
+
+	int64_t SegmentedBuffer::find_handle(const Label& label) const {
+		const uint64_t id = label.identifier();
+
+		if (id >= window_base && id - window_base < window.size()) {
+			const uint32_t slot = window[id - window_base];
+
+			// an empty slot can still belong to a label seen before the window grew over it
+			if (slot != 0 || displaced == 0) {
+				return static_cast<int64_t>(slot) - 1;
+			}
+		}
+
+		auto it = handles.find(label);
+		return (it == handles.end()) ? -1 : static_cast<int64_t>(it->second);
+	}
+
+	BufferMarker SegmentedBuffer::get_position(uint32_t handle) const {
+		const BufferMarker marker = positions[handle];
+
+		if (marker.section == UNDEFINED_SECTION) {
+			throw std::runtime_error {"Undefined label '" + names[handle].string() + "' used"};
+		}
+
+		return marker;
+	}
+
+	uint32_t SegmentedBuffer::get_handle(const Label& label) {
+		const uint32_t next = positions.size();
+
+		if (const uint64_t id = label.identifier()) {
+			if (window.empty()) {
+				window_base = id;
+			}
+
+			// only grow the window while it stays reasonably dense
+			const uint64_t index = id - window_base;
+
+			if (id >= window_base && index < window.size() * 2 + 1024) {
+				if (index >= window.size()) {
+					window.resize(index + 1, 0);
+				}
+
+				if (window[index] == 0) {
+
+					// the label could have been seen before the window grew over it, then it already has a handle in the map
+					if (displaced > 0) {
+						if (auto it = handles.find(label); it != handles.end()) {
+							window[index] = it->second + 1;
+							handles.erase(it);
+							displaced --;
+							return window[index] - 1;
+						}
+					}
+
+					window[index] = next + 1;
+					names.push_back(label);
+					positions.push_back({UNDEFINED_SECTION, 0});
+				}
+
+				return window[index] - 1;
+			}
+		}
+
+		auto [it, inserted] = handles.try_emplace(label, next);
+
+		if (inserted) {
+			if (label.identifier()) displaced ++;
+			names.push_back(label);
+			positions.push_back({UNDEFINED_SECTION, 0});
+		}
+
+		return it->second;
 	}
 
 	BufferMarker SegmentedBuffer::get_label(const Label& label) {
-		auto it = labels.find(label);
+		const int64_t handle = find_handle(label);
 
-		if (it != labels.end()) {
-			return it->second;
+		if (handle < 0 || positions[handle].section == IMPORTED_SECTION) {
+			throw std::runtime_error {"Undefined label '" + label.string() + "' used"};
 		}
 
-		throw std::runtime_error {"Undefined label '" + label.string() + "' used"};
+		return get_position(handle);
 	}
 
 	void SegmentedBuffer::add_label(const Label& label) {
-		auto it = labels.find(label);
+		BufferMarker& marker = positions[get_handle(label)];
 
-		if (it == labels.end()) {
-			labels[label] = sections[selected].current();
+		if (marker.section == UNDEFINED_SECTION) {
+			marker = sections[selected].current();
 			return;
 		}
 
@@ -130,7 +592,32 @@ namespace asmio {
 	}
 
 	bool SegmentedBuffer::has_label(const Label& label) {
-		return labels.contains(label);
+		const int64_t handle = find_handle(label);
+		return handle >= 0 && positions[handle].section < IMPORTED_SECTION;
+	}
+
+	void SegmentedBuffer::add_import(const Label& label, size_t address) {
+		BufferMarker& marker = positions[get_handle(label)];
+
+		if (marker.section == UNDEFINED_SECTION) {
+			marker = {IMPORTED_SECTION, static_cast<uint32_t>(imports.size())};
+			imports.push_back(address);
+			return;
+		}
+
+		throw std::runtime_error {"Can't import label '" + label.string() + "', it is already defined"};
+	}
+
+	std::vector<Label> SegmentedBuffer::undefined_labels() const {
+		std::vector<Label> result;
+
+		for (size_t handle = 0; handle < names.size(); handle ++) {
+			if (positions[handle].section == UNDEFINED_SECTION) {
+				result.push_back(names[handle]);
+			}
+		}
+
+		return result;
 	}
 
 	void SegmentedBuffer::push(uint8_t byte) {
@@ -178,7 +665,7 @@ namespace asmio {
 	}
 
 	size_t SegmentedBuffer::total() const {
-		auto last = sections.back();
+		const BufferSegment& last = sections.back();
 		return last.start + last.buffer.size() + last.tail;
 	}
 
@@ -211,8 +698,10 @@ namespace asmio {
 	LabelMap<size_t> SegmentedBuffer::resolved_labels() const {
 		LabelMap<size_t> result;
 
-		for (auto& [label, marker] : labels) {
-			result[label] = get_offset(marker);
+		for (size_t handle = 0; handle < names.size(); handle ++) {
+			if (positions[handle].section < IMPORTED_SECTION) {
+				result[names[handle]] = get_offset(positions[handle]);
+			}
 		}
 
 		return result;
@@ -13,15 +13,27 @@ namespace asmio {
 		uint32_t offset;
 	};
 
-	/// Single link job entry
+	/// Single link job entry, describes what value to compute and how to store it at the target
 	struct Linkage {
 
-		using Linker = std::function<void(class SegmentedBuffer* buffer, const Linkage& link, size_t mount)>;
+		using Linker = void (*) (class SegmentedBuffer* buffer, const Linkage& link, size_t mount);
 		using Handler = std::function<void(const Linkage& link, const char* what)>;
 
-		Label label;
+		enum Kind : uint8_t {
+			RELATIVE, ///< distance from the target to the label, stored as 'width' little endian bytes
+			ABSOLUTE, ///< address of the label, stored as 'width' little endian bytes
+			ALIGNED,  ///< distance in 4 byte units, OR-ed into a 32 bit word as a 'width' bit field starting at 'bit'
+			LO_HI,    ///< distance OR-ed into a 32 bit word as the 2 bit 'immlo' and 19 bit 'immhi' fields of aarch64 ADR
+			CUSTOM,   ///< computed and stored by the 'linker' callback
+		};
+
+		uint32_t label;  ///< label handle, see SegmentedBuffer::get_handle()
 		BufferMarker target;
-		Linker linker;
+		int32_t addend = 0;
+		Kind kind = CUSTOM;
+		uint8_t width = 0;
+		uint8_t bit = 0;
+		Linker linker = nullptr;
 
 	};
 
@@ -40,6 +52,32 @@ namespace asmio {
 
 	};
 
+	/// Jump that was written in its short form, and that can be grown into its long form by
+	/// SegmentedBuffer::relax() if the target is out of reach, the displacement needs to be a RELATIVE linkage
+	struct Relaxation {
+
+		BufferMarker start;              // first byte of the short instruction
+		uint32_t linkage;                // index of the displacement linkage of the short instruction
+		uint8_t length;                  // length of the short instruction, the last byte is the displacement
+		uint8_t width;                   // width of the long form displacement
+		uint8_t size;                    // length of the long form instruction, ending with the displacement
+		std::array<uint8_t, 8> grown;    // bytes of the long form instruction
+
+	};
+
+	/// Alignment padding written by SegmentedBuffer::pad(), it is resized by SegmentedBuffer::relax() if the code in front of it moves
+	struct Padding {
+
+		/// Writes 'bytes' bytes of padding starting at the target, called again with the new length when the padding is resized
+		using Filler = void (*) (uint8_t* target, size_t bytes);
+
+		BufferMarker start;              // first byte of the padding
+		uint32_t length;                 // number of padding bytes
+		uint32_t alignment;              // the offset after the padding is a multiple of this value
+		Filler filler;                   // function used to write the padding bytes, zeros are used if this is null
+
+	};
+
 	/// One track in the SegmentedBuffer
 	struct BufferSegment {
 
@@ -90,9 +128,33 @@ namespace asmio {
 			size_t base_address = 0; // this is set during linking and used ONLY for debugging
 			int selected = 0;
 			std::vector<BufferSegment> sections;
-			LabelMap<BufferMarker> labels;
+
+			// labels are given dense handles that index the 'names' and 'positions' arrays,
+			// anonymous labels from Label::make_unique() are mostly seen in the order they were created,
+			// so their handles can be found in a window indexed by the label identifier without hashing
+			LabelMap<uint32_t> handles;
+			std::vector<uint32_t> window; // handle + 1 of the anonymous label 'window_base + index', or zero
+			uint64_t window_base = 0;
+			size_t displaced = 0; // number of anonymous labels in 'handles', they are moved into the window once it reaches them
+			std::vector<Label> names;
+			std::vector<BufferMarker> positions;
+			std::vector<size_t> imports; // absolute addresses of imported labels
 			std::vector<Linkage> linkages;
 			std::vector<ExportSymbol> exported_symbols;
+			std::vector<Relaxation> relaxations;
+			std::vector<Padding> paddings;
+			size_t padded = 1; // largest alignment given to pad(), the paddings are dropped once relaxed but this value stays
+			bool relaxing = false;
+			size_t link_workers = 1;
+
+			/// Compute and store the value of a single linkage
+			void apply(const Linkage& linkage, size_t mount);
+
+			/// Find the handle of an already seen label, returns a negative value if there is none
+			int64_t find_handle(const Label& label) const;
+
+			/// Throw if the label with the given handle was not yet defined
+			BufferMarker get_position(uint32_t handle) const;
 
 		public:
 
@@ -116,11 +178,44 @@ namespace asmio {
 			/// Needs to be called before linking, calculates sections start/end offsets
 			void align(size_t page);
 
-			/// Execute all linkages
+			/// Enable or disable jump relaxation, this only affects jumps written after this call,
+			/// when enabled writers emit label jumps in the short form and register them with add_relaxation()
+			void set_relaxation(bool enable);
+
+			/// Check if jump relaxation is enabled
+			bool has_relaxation() const;
+
+			/// Register the short jump that was just written as relaxable, it needs to end with a one byte displacement that was
+			/// the last linkage added, 'grown' is the long form of the jump with a zeroed displacement of 'width' bytes at the end
+			void add_relaxation(uint8_t length, std::initializer_list<uint8_t> grown, uint8_t width);
+
+			/// Pad the current section with the given filler until its size is a multiple of 'alignment', which must be a power of two,
+			/// the alignment is relative to the start of the section so it only holds in memory if align() is given a multiple of it
+			void pad(size_t alignment, Padding::Filler filler = nullptr);
+
+			/// Get the largest alignment that was passed to pad(), or one if it was never called,
+			/// the sections need to be placed at a multiple of this value for all paddings to hold
+			size_t get_alignment() const;
+
+			/// Grow the relaxable jumps that can't reach their targets and move all the code after them, resizing paddings on the way,
+			/// this is called by align() so it doesn't need to be called manually, returns the number of bytes saved
+			size_t relax();
+
+			/// Execute all linkages, errors are reported to the handler in the linkage order
 			void link(size_t base, const Linkage::Handler& handler = nullptr);
 
-			/// Insert linker command to be executed once link() is called
-			void add_linkage(const Label& label, int shift, const Linkage::Linker& linker);
+			/// Set the number of threads used by link(), zero selects one per hardware thread,
+			/// when more than one is used all custom linkers need to be thread safe
+			void set_link_workers(size_t workers);
+
+			/// Insert linker command to be executed once link() is called, the target is the current position moved by 'shift'
+			void add_linkage(const Label& label, int shift, Linkage::Kind kind, uint8_t width, int32_t addend = 0, uint8_t bit = 0);
+
+			/// Insert linker command that will call the given function once link() is called
+			void add_linkage(const Label& label, int shift, Linkage::Linker linker);
+
+			/// Get the dense handle of a label in this buffer, the handle is assigned when the label is first seen
+			uint32_t get_handle(const Label& label);
 
 			/// Get the label value
 			BufferMarker get_label(const Label& label);
@@ -128,9 +223,16 @@ namespace asmio {
 			/// Add the given label into the buffer
 			void add_label(const Label& label);
 
-			/// Check if given labels have already been defined
+			/// Check if given labels have already been defined, imported labels are not defined in this buffer
 			bool has_label(const Label& label);
 
+			/// Resolve a label that is not defined in this buffer to the given absolute address,
+			/// this allows linking against code that was already placed in memory
+			void add_import(const Label& label, size_t address);
+
+			/// Get the labels that were used, but are neither defined nor imported
+			std::vector<Label> undefined_labels() const;
+
 			/// Append a single byte to the current section
 			void push(uint8_t byte);
 
@@ -161,7 +263,7 @@ namespace asmio {
 			/// Get a list of exported symbols
 			const std::vector<ExportSymbol>& exports() const;
 
-			/// Add new symbol to the export list
+			/// Add new symbol to the export list, a non-zero size is widened by relax() if jumps inside it grow
 			void add_export(const Label& label, ExportSymbol::Type type, size_t size);
 
 	};
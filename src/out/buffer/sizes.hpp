@@ -11,6 +11,9 @@ namespace asmio {
 		DWORD = 4,
 		QWORD = 8,
 		TWORD = 10,
+		XWORD = 16,
+		YWORD = 32,
+		ZWORD = 64,
 	};
 
 }
\ No newline at end of file
@@ -0,0 +1,60 @@
+
+#include "symbols.hpp"
+
+namespace asmio {
+
+	std::vector<CodeSymbol> code_symbols(const SegmentedBuffer& segmented) {
+
+		LabelMap<size_t> sizes;
+		std::vector<CodeSymbol> symbols;
+
+		for (const ExportSymbol& symbol : segmented.exports()) {
+			sizes[symbol.label] = symbol.size;
+		}
+
+		const auto& segments = segmented.segments();
+
+		for (const auto& [label, offset] : segmented.resolved_labels()) {
+			if (!label.is_text()) {
+				continue;
+			}
+
+			for (size_t i = 0; i < segments.size(); i ++) {
+				const BufferSegment& segment = segments[i];
+				const size_t start = segment.start;
+
+				if ((segment.flags & BufferSegment::X) && offset >= start && offset < start + segment.buffer.size()) {
+					auto it = sizes.find(label);
+					const size_t exported = (it == sizes.end()) ? 0 : it->second;
+
+					symbols.emplace_back(label.string(), offset, start + segment.buffer.size() - offset, exported, i);
+					break;
+				}
+			}
+		}
+
+		std::sort(symbols.begin(), symbols.end(), [] (const CodeSymbol& a, const CodeSymbol& b) {
+			return a.offset < b.offset;
+		});
+
+		for (size_t i = 0; i < symbols.size(); i ++) {
+			CodeSymbol& symbol = symbols[i];
+
+			if (symbol.exported != 0) {
+				symbol.size = std::min(symbol.size, symbol.exported);
+				continue;
+			}
+
+			// the next symbol starting further on in the same segment ends this one
+			for (size_t j = i + 1; j < symbols.size(); j ++) {
+				if (symbols[j].offset > symbol.offset) {
+					symbol.size = std::min(symbol.size, symbols[j].offset - symbol.offset);
+					break;
+				}
+			}
+		}
+
+		return symbols;
+	}
+
+}
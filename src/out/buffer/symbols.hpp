@@ -0,0 +1,21 @@
+#pragma once
+
+#include "external.hpp"
+#include "segmented.hpp"
+
+namespace asmio {
+
+	/// Named location in an executable segment of a linked buffer, as described to profilers and debuggers
+	struct CodeSymbol {
+		std::string name;
+		size_t offset;   ///< offset from the start of the whole buffer
+		size_t size;     ///< size in bytes, never crosses the end of the segment
+		size_t exported; ///< size given in the export, or zero
+		size_t segment;  ///< index of the segment holding the symbol
+	};
+
+	/// Collect the named labels of executable segments, sorted by offset, the size of a symbol is taken from
+	/// its export, or otherwise it extends to the next symbol or the end of the segment
+	std::vector<CodeSymbol> code_symbols(const SegmentedBuffer& segmented);
+
+}
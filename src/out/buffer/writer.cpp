@@ -4,8 +4,8 @@
 
 namespace asmio {
 
-	BasicBufferWriter::BasicBufferWriter(SegmentedBuffer& buffer)
-		: buffer(buffer) {
+	BasicBufferWriter::BasicBufferWriter(SegmentedBuffer& buffer, Padding::Filler filler)
+		: buffer(buffer), filler(filler) {
 	}
 
 	BasicBufferWriter& BasicBufferWriter::section(uint8_t flags, const std::string& name) {
@@ -23,6 +23,11 @@ namespace asmio {
 		return *this;
 	}
 
+	BasicBufferWriter& BasicBufferWriter::align(size_t alignment) {
+		buffer.pad(alignment, filler);
+		return *this;
+	}
+
 	void BasicBufferWriter::put_byte(uint8_t byte) {
 		buffer.push(byte);
 	}
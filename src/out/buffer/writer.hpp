@@ -11,14 +11,16 @@ namespace asmio {
 		protected:
 
 			SegmentedBuffer& buffer;
+			Padding::Filler filler; // used by align(), architecture writers set it to write their no-op instructions
 
 		public:
 
-			BasicBufferWriter(SegmentedBuffer& buffer);
+			BasicBufferWriter(SegmentedBuffer& buffer, Padding::Filler filler = nullptr);
 
 			BasicBufferWriter& section(uint8_t flags, const std::string& name = "");
 			BasicBufferWriter& label(const Label& label);
 			BasicBufferWriter& export_symbol(const Label& label, ExportSymbol::Type type = ExportSymbol::PUBLIC, size_t size = 0);
+			BasicBufferWriter& align(size_t alignment);
 
 			void put_cstr(const char* str);
 			void put_cstr(const std::string& str);
@@ -0,0 +1,166 @@
+
+#include "gdb.hpp"
+
+#include <out/buffer/symbols.hpp>
+
+#include <mutex>
+#include <atomic>
+#include <fstream>
+#include <ctime>
+
+// how long the result of checking for a tracer is reused, in nanoseconds
+#define TRACER_CHECK_INTERVAL 100'000'000
+
+extern "C" {
+
+	// weak, so that the process can also contain other JIT compilers defining the same interface,
+	// all of them then share one list, which is exactly what the debugger expects
+	__attribute__((weak, noinline, used)) void __jit_debug_register_code() {
+		asm volatile ("" ::: "memory");
+	}
+
+	__attribute__((weak, used)) jit_descriptor __jit_debug_descriptor = {1, JIT_NOACTION, nullptr, nullptr};
+
+}
+
+namespace asmio {
+
+	static std::atomic<GdbRegistration> selected = GdbRegistration::TRACED;
+	static std::atomic<int64_t> recheck_at = 0;
+	static std::atomic<bool> traced = false;
+	static std::mutex lock;
+
+	/// Check the TracerPid field, set when a debugger is attached with ptrace
+	static bool is_traced() {
+		std::ifstream status {"/proc/self/status"};
+		std::string line;
+
+		while (std::getline(status, line)) {
+			if (line.starts_with("TracerPid:")) {
+				return std::stoi(line.substr(10)) != 0;
+			}
+		}
+
+		return false;
+	}
+
+	/// Reading the status file takes a few microseconds, which would dominate appending small code, so the result is
+	/// reused for a while, the coarse clock is read from the vDSO in a couple of nanoseconds
+	static bool should_register() {
+		switch (selected.load(std::memory_order_relaxed)) {
+			case GdbRegistration::NEVER: return false;
+			case GdbRegistration::ALWAYS: return true;
+			case GdbRegistration::TRACED: break;
+		}
+
+		timespec time {};
+		clock_gettime(CLOCK_MONOTONIC_COARSE, &time);
+		const int64_t now = static_cast<int64_t>(time.tv_sec) * 1'000'000'000 + time.tv_nsec;
+
+		if (now >= recheck_at.load(std::memory_order_relaxed)) {
+			traced = is_traced();
+			recheck_at = now + TRACER_CHECK_INTERVAL;
+		}
+
+		return traced;
+	}
+
+	void set_gdb_registration(GdbRegistration mode) {
+		selected = mode;
+		recheck_at = 0;
+	}
+
+	/*
+	 * class GdbSymbolFile
+	 */
+
+	GdbSymbolFile::GdbSymbolFile(std::vector<uint8_t> file)
+	: file(std::move(file)) {
+
+		entry.symfile_addr = reinterpret_cast<const char*>(this->file.data());
+		entry.symfile_size = this->file.size();
+
+		std::lock_guard guard {lock};
+		jit_descriptor& descriptor = __jit_debug_descriptor;
+
+		entry.next_entry = descriptor.first_entry;
+
+		if (entry.next_entry != nullptr) {
+			entry.next_entry->prev_entry = &entry;
+		}
+
+		descriptor.first_entry = &entry;
+		descriptor.relevant_entry = &entry;
+		descriptor.action_flag = JIT_REGISTER_FN;
+		__jit_debug_register_code();
+
+	}
+
+	GdbSymbolFile::~GdbSymbolFile() {
+
+		std::lock_guard guard {lock};
+		jit_descriptor& descriptor = __jit_debug_descriptor;
+
+		if (entry.prev_entry != nullptr) {
+			entry.prev_entry->next_entry = entry.next_entry;
+		} else {
+			descriptor.first_entry = entry.next_entry;
+		}
+
+		if (entry.next_entry != nullptr) {
+			entry.next_entry->prev_entry = entry.prev_entry;
+		}
+
+		descriptor.relevant_entry = &entry;
+		descriptor.action_flag = JIT_UNREGISTER_FN;
+		__jit_debug_register_code();
+
+	}
+
+	const std::vector<uint8_t>& GdbSymbolFile::bytes() const {
+		return file;
+	}
+
+	/*
+	 * Symbol files
+	 */
+
+	ElfFile to_symbol_elf(const SegmentedBuffer& segmented, const uint8_t* base) {
+
+		// a relocatable file, GDB places each section at its address and the symbols are relative to their sections
+		ElfFile elf {ElfMachine::NATIVE, ElfType::REL, 0, 0};
+		std::vector<int> sections;
+
+		for (const BufferSegment& segment : segmented.segments()) {
+			if (segment.empty() || !(segment.flags & BufferSegment::X)) {
+				sections.push_back(0);
+				continue;
+			}
+
+			ElfSectionCreateInfo info {};
+			info.address = reinterpret_cast<uint64_t>(base + segment.start);
+			info.flags = ElfSectionFlags::R | ElfSectionFlags::X;
+
+			auto section = elf.section(segment.name, ElfSectionType::PROGBITS, info);
+			section.data->write(segment.buffer);
+			sections.push_back(section.index);
+		}
+
+		for (const CodeSymbol& symbol : code_symbols(segmented)) {
+			const BufferSegment& segment = segmented.segments()[symbol.segment];
+			elf.symbol(symbol.name, ElfSymbolType::FUNC, ElfSymbolBinding::GLOBAL, ElfSymbolVisibility::DEFAULT, sections[symbol.segment], symbol.offset - segment.start, symbol.size);
+		}
+
+		return elf;
+	}
+
+	std::unique_ptr<GdbSymbolFile> gdb_record(const SegmentedBuffer& segmented, const uint8_t* base) {
+
+		if (!should_register()) {
+			return nullptr;
+		}
+
+		return std::make_unique<GdbSymbolFile>(to_symbol_elf(segmented, base).bytes());
+	}
+
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "external.hpp"
+#include <out/buffer/segmented.hpp>
+#include <out/elf/buffer.hpp>
+
+// see "JIT Compilation Interface" in the GDB manual, the names and layout are fixed by the debugger
+extern "C" {
+
+	enum jit_actions_t : uint32_t {
+		JIT_NOACTION = 0,
+		JIT_REGISTER_FN,
+		JIT_UNREGISTER_FN
+	};
+
+	struct jit_code_entry {
+		jit_code_entry* next_entry;
+		jit_code_entry* prev_entry;
+		const char* symfile_addr;
+		uint64_t symfile_size;
+	};
+
+	struct jit_descriptor {
+		uint32_t version;
+		uint32_t action_flag;
+		jit_code_entry* relevant_entry;
+		jit_code_entry* first_entry;
+	};
+
+	/// The debugger places a breakpoint in this function and reads the descriptor each time it is hit
+	void __jit_debug_register_code();
+
+	/// List of all symbol files currently registered in this process
+	extern jit_descriptor __jit_debug_descriptor;
+
+}
+
+namespace asmio {
+
+	/// When the code placed in memory by ExecutableBuffer and CodeCache should be described to GDB
+	enum struct GdbRegistration : uint8_t {
+		NEVER,  ///< no symbol files are ever created
+		TRACED, ///< only create symbol files when the process is being traced, code placed before a debugger attaches is not described
+		ALWAYS, ///< always create symbol files, so that a debugger attaching later can see all code
+	};
+
+	/// Select when code is described to GDB, by default only traced processes are
+	void set_gdb_registration(GdbRegistration mode);
+
+	/// In-memory ELF file describing one piece of code, registered with GDB for as long as this object lives
+	class GdbSymbolFile {
+
+		private:
+
+			std::vector<uint8_t> file;
+			jit_code_entry entry {};
+
+		public:
+
+			explicit GdbSymbolFile(std::vector<uint8_t> file);
+			GdbSymbolFile(const GdbSymbolFile& other) = delete;
+			GdbSymbolFile(GdbSymbolFile&& other) = delete;
+			~GdbSymbolFile();
+
+			/// Get the serialized ELF file
+			const std::vector<uint8_t>& bytes() const;
+
+	};
+
+	/// Create an ELF file holding the executable segments of a linked buffer placed at 'base', each of them as
+	/// a section at its real address, together with a function symbol for each of their named labels
+	ElfFile to_symbol_elf(const SegmentedBuffer& segmented, const uint8_t* base);
+
+	/// Describe the code of a linked buffer placed at 'base' to GDB, this is called by ExecutableBuffer and CodeCache whenever
+	/// code is placed in memory, the returned file needs to be kept until that code is unmapped, null is returned if nothing was registered
+	std::unique_ptr<GdbSymbolFile> gdb_record(const SegmentedBuffer& segmented, const uint8_t* base);
+
+}
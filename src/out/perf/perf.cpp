@@ -0,0 +1,174 @@
+
+#include "perf.hpp"
+
+#include <out/buffer/symbols.hpp>
+
+#include <mutex>
+#include <atomic>
+#include <ctime>
+
+// see tools/perf/Documentation/jitdump-specification.txt in the linux kernel tree
+#define JITDUMP_MAGIC 0x4A695444
+#define JITDUMP_VERSION 1
+#define JITDUMP_CODE_LOAD 0
+
+namespace asmio {
+
+	struct JitdumpHeader {
+		uint32_t magic;
+		uint32_t version;
+		uint32_t total_size;
+		uint32_t elf_mach;
+		uint32_t pad1;
+		uint32_t pid;
+		uint64_t timestamp;
+		uint64_t flags;
+	};
+
+	struct JitdumpCodeLoad {
+		uint32_t id;
+		uint32_t total_size;
+		uint64_t timestamp;
+		uint32_t pid;
+		uint32_t tid;
+		uint64_t vma;
+		uint64_t code_addr;
+		uint64_t code_size;
+		uint64_t code_index;
+	};
+
+	static std::atomic<uint8_t> selected = PERF_NONE;
+	static std::mutex lock;
+
+	static FILE* map_file = nullptr;
+	static int dump_fd = -1;
+	static void* dump_marker = nullptr;
+	static uint64_t dump_index = 0;
+
+	/// Same clock as used by 'perf record -k mono'
+	static uint64_t timestamp() {
+		timespec time {};
+		clock_gettime(CLOCK_MONOTONIC, &time);
+		return static_cast<uint64_t>(time.tv_sec) * 1'000'000'000 + time.tv_nsec;
+	}
+
+	static void close_files() {
+		if (map_file != nullptr) {
+			fclose(map_file);
+			map_file = nullptr;
+		}
+
+		if (dump_marker != nullptr) {
+			munmap(dump_marker, getpagesize());
+			dump_marker = nullptr;
+		}
+
+		if (dump_fd != -1) {
+			close(dump_fd);
+			dump_fd = -1;
+		}
+	}
+
+	static void open_jitdump() {
+		const std::string path = "/tmp/jit-" + std::to_string(getpid()) + ".dump";
+		dump_fd = open(path.c_str(), O_CREAT | O_TRUNC | O_RDWR | O_CLOEXEC, 0644);
+
+		if (dump_fd == -1) {
+			throw std::runtime_error {"Failed to create jitdump file '" + path + "'!"};
+		}
+
+		JitdumpHeader header {};
+		header.magic = JITDUMP_MAGIC;
+		header.version = JITDUMP_VERSION;
+		header.total_size = sizeof(JitdumpHeader);
+		header.elf_mach = static_cast<uint32_t>(ElfMachine::NATIVE);
+		header.pid = getpid();
+		header.timestamp = timestamp();
+
+		if (write(dump_fd, &header, sizeof(header)) != sizeof(header)) {
+			close_files();
+			throw std::runtime_error {"Failed to write jitdump file '" + path + "'!"};
+		}
+
+		// perf finds the file through this executable mapping of it
+		dump_marker = mmap(nullptr, getpagesize(), PROT_READ | PROT_EXEC, MAP_PRIVATE, dump_fd, 0);
+
+		if (dump_marker == MAP_FAILED) {
+			dump_marker = nullptr;
+			close_files();
+			throw std::runtime_error {"Failed to map jitdump file '" + path + "'!"};
+		}
+	}
+
+	void set_perf_output(uint8_t outputs) {
+		std::lock_guard guard {lock};
+		close_files();
+		selected = PERF_NONE;
+
+		if (outputs & PERF_MAP) {
+			const std::string path = "/tmp/perf-" + std::to_string(getpid()) + ".map";
+			map_file = fopen(path.c_str(), "a");
+
+			if (map_file == nullptr) {
+				throw std::runtime_error {"Failed to open perf map file '" + path + "'!"};
+			}
+		}
+
+		if (outputs & PERF_JITDUMP) {
+			open_jitdump();
+		}
+
+		selected = outputs;
+	}
+
+	void perf_record(const SegmentedBuffer& segmented, const uint8_t* base) {
+
+		if (selected == PERF_NONE) {
+			return;
+		}
+
+		const std::vector<CodeSymbol> symbols = code_symbols(segmented);
+		std::lock_guard guard {lock};
+
+		for (const CodeSymbol& symbol : symbols) {
+			const uint64_t address = reinterpret_cast<uint64_t>(base + symbol.offset);
+			const std::string& name = symbol.name;
+
+			if (map_file != nullptr) {
+				fprintf(map_file, "%" PRIx64 " %zx %s\n", address, symbol.size, name.c_str());
+			}
+
+			if (dump_fd != -1) {
+				JitdumpCodeLoad record {};
+				record.id = JITDUMP_CODE_LOAD;
+				record.total_size = sizeof(JitdumpCodeLoad) + name.size() + 1 + symbol.size;
+				record.timestamp = timestamp();
+				record.pid = getpid();
+				record.tid = gettid();
+				record.vma = address;
+				record.code_addr = address;
+				record.code_size = symbol.size;
+				record.code_index = dump_index ++;
+
+				const BufferSegment& segment = segmented.segments()[symbol.segment];
+				const uint8_t* code = segment.buffer.data() + (symbol.offset - segment.start);
+
+				std::string bytes;
+				bytes.reserve(record.total_size);
+				bytes.append(reinterpret_cast<const char*>(&record), sizeof(record));
+				bytes.append(name.c_str(), name.size() + 1);
+				bytes.append(reinterpret_cast<const char*>(code), symbol.size);
+
+				if (write(dump_fd, bytes.data(), bytes.size()) != static_cast<ssize_t>(bytes.size())) {
+					throw std::runtime_error {"Failed to write jitdump record!"};
+				}
+			}
+		}
+
+		if (map_file != nullptr) {
+			fflush(map_file);
+		}
+
+	}
+
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "external.hpp"
+#include <out/buffer/segmented.hpp>
+
+namespace asmio {
+
+	/// Files read by the linux 'perf' tool to attribute samples to JIT code
+	enum PerfOutput : uint8_t {
+		PERF_NONE    = 0b00,
+		PERF_MAP     = 0b01, ///< text file '/tmp/perf-<pid>.map', used by 'perf report' directly
+		PERF_JITDUMP = 0b10, ///< binary file '/tmp/jit-<pid>.dump' that includes the code, used with 'perf record -k mono' and 'perf inject --jit'
+	};
+
+	/// Select the files written when code is baked, nothing is written by default
+	void set_perf_output(uint8_t outputs);
+
+	/// Describe the code of a linked buffer placed at 'base' in the selected files, this is called by
+	/// ExecutableBuffer and CodeCache whenever code is placed in memory, and does nothing when no files are selected
+	void perf_record(const SegmentedBuffer& segmented, const uint8_t* base);
+
+}
@@ -8,6 +8,7 @@
 #include <iostream>
 #include <fstream>
 #include <asm/module.hpp>
+#include <util/mapped.hpp>
 
 #include "top.hpp"
 
@@ -15,6 +16,19 @@
 #define EXIT_PARSE_ERROR 3
 #define EXIT_LINKE_ERROR 4
 
+/// Parse the number of linker threads, it needs to be a positive integer
+static size_t parse_jobs(const std::string& value) {
+	size_t jobs = 0;
+	const char* end = value.data() + value.size();
+	const auto [ptr, error] = std::from_chars(value.data(), end, jobs);
+
+	if (error != std::errc {} || ptr != end || jobs == 0) {
+		throw std::runtime_error {"Invalid number of jobs '" + value + "', expected a positive integer"};
+	}
+
+	return jobs;
+}
+
 int main(int argc, char** argv) {
 
 	tasml::Args args;
@@ -22,6 +36,8 @@ int main(int argc, char** argv) {
 	args.define("-i").define("--stdin");
 	args.define("-o", 1).define("--output", 1);
 	args.define("--xansi");
+	args.define("--relax");
+	args.define("-j", 1).define("--jobs", 1);
 	args.define("-?").define("-h").define("--help");
 	args.define("--version");
 	args.define("-M").define("--modules");
@@ -37,6 +53,8 @@ int main(int argc, char** argv) {
 		printf("  -i, --stdin    Read input from stdin, not file\n");
 		printf("  -o, --output   Place the output into <file>\n");
 		printf("      --xansi    Disables colored output\n");
+		printf("      --relax    Use the shortest jumps that fit\n");
+		printf("  -j, --jobs     Number of linker threads\n");
 		printf("  -M, --modules  List language modules and exit\n");
 		printf("      --version  Display version information and exit\n");
 
@@ -59,7 +77,6 @@ int main(int argc, char** argv) {
 		return EXIT_OK;
 	}
 
-	std::string assembly;
 	std::string input = "<stdin>"; // path
 	std::string output = "a.out"; // path
 
@@ -77,36 +94,44 @@ int main(int argc, char** argv) {
 		return EXIT_ERROR;
 	}
 
-	if (args.has("-i") || args.has("--stdin")) {
-		char chr;
+	const bool streamed = args.has("-i") || args.has("--stdin");
+	const bool relax = args.has("--relax");
+	std::optional<asmio::util::MappedFile> file;
 
-		// assert no tail
+	if (streamed) {
+		// assert no tail, input is streamed during assembly
 		args.tail(0);
-
-		// load until end of input is reached
-		while (std::cin.get(chr)){
-			assembly.push_back(chr);
-		}
 	} else {
 		input = args.tail(1).at(0);
-		std::ifstream file {input};
 
-		if (!file.is_open()) {
+		// map the whole file, the tokens will point directly into the mapping
+		file.emplace(input);
+
+		if (!file->is_open()) {
 			printf("Failed to read input!\n");
 			return EXIT_ERROR;
 		}
-
-		asmio::util::load_file_into(file, assembly);
 	}
 
 	tasml::ErrorHandler handler {input, !args.has("--xansi")};
 
 	try {
 
+		size_t jobs = 1;
+
+		if (args.has("-j")) {
+			jobs = parse_jobs(args.get("-j").at(0));
+		}
+
+		if (args.has("--jobs")) {
+			jobs = parse_jobs(args.get("--jobs").at(0));
+		}
+
 		// assemble, on failer this will throw
-		asmio::SegmentedBuffer buffer = tasml::assemble(handler, assembly);
+		asmio::SegmentedBuffer buffer = streamed ? tasml::assemble(handler, std::cin, relax) : tasml::assemble(handler, file->view(), relax);
 
 		// link and create the final ELF file
+		buffer.set_link_workers(jobs);
 		asmio::ElfFile elf = asmio::to_elf(buffer, "_start", DEFAULT_ELF_MOUNT, [&] (const auto& link, const char* what) {
 			handler.link(link.target, what);
 		});
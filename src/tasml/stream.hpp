@@ -168,7 +168,7 @@ namespace tasml {
 				const Token& last = prev();
 
 				if (token.line == last.line) {
-					throw std::runtime_error {"Unexpected token '" + token.raw + "', expected end of line or semicolon!"};
+					throw std::runtime_error {"Unexpected token '" + std::string {token.raw} + "', expected end of line or semicolon!"};
 				}
 
 			}
@@ -203,6 +203,18 @@ namespace tasml {
 				return TokenStream {tokens, begin - 1, finish, name};
 			}
 
+			/// Consumes tokens until the end of input or a token matching the predicate is reached,
+			/// the matching token is not consumed. Returns a sub-stream of the consumed tokens
+			TokenStream until(const TokenPredicate& predicate, const char* name = "expression") {
+				long begin = index;
+
+				while (!empty() && !predicate.test(peek())) {
+					next();
+				}
+
+				return TokenStream {tokens, begin - 1, index, name};
+			}
+
 			/// Consumes tokens until the end of line or a ';' is reached
 			/// Returns a sub-stream of the consumed tokens
 			TokenStream statement(const char* name = "statement") {
@@ -16,9 +16,9 @@ namespace tasml {
 		}
 
 		try {
-			return asmio::util::parse_int(raw.c_str());
+			return asmio::util::parse_int(raw);
 		} catch(std::runtime_error& error) {
-			throw std::runtime_error {"Internal lexer error, " + std::string {error.what()} + " while parsing int! In: '" + raw + "'"};
+			throw std::runtime_error {"Internal lexer error, " + std::string {error.what()} + " while parsing int! In: '" + std::string {raw} + "'"};
 		}
 	}
 
@@ -33,9 +33,9 @@ namespace tasml {
 		}
 
 		try {
-			return asmio::util::parse_float(raw.c_str());
+			return asmio::util::parse_float(std::string {raw}.c_str());
 		} catch(std::runtime_error& error) {
-			throw std::runtime_error {"Internal lexer error, " + std::string {error.what()} + " while parsing float! In: '" + raw + "'"};
+			throw std::runtime_error {"Internal lexer error, " + std::string {error.what()} + " while parsing float! In: '" + std::string {raw} + "'"};
 		}
 	}
 
@@ -67,11 +67,11 @@ namespace tasml {
 
 	std::string Token::as_label() const {
 		if (type == LABEL) {
-			return raw.substr(0, raw.length() - 1);
+			return std::string {raw.substr(0, raw.length() - 1)};
 		}
 
 		if (type == REFERENCE) {
-			return raw.substr(1);
+			return std::string {raw.substr(1)};
 		}
 
 		throw std::runtime_error {"Internal lexer error, can't convert non label into a label value!"};
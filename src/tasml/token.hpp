@@ -47,23 +47,20 @@ namespace tasml {
 		/// Get the label string of a label (the part without ':')
 		std::string as_label() const;
 
-		const size_t line;
-		const size_t column;
+		const uint32_t line;
+		const uint32_t column;
 		const size_t offset;
-		const size_t length;
-		const std::string raw;
+		const uint32_t length;
 		const Type type;
 
-		// implicit length constructor
-		Token(size_t line, size_t column, size_t offset, const std::string& raw, Type type)
-		: Token(line, column, offset, raw.length(), raw, type) {}
+		/// View into the tokenized source, the source needs to outlive the token
+		const std::string_view raw;
 
-		// explicit length constructor
-		Token(size_t line, size_t column, size_t offset, size_t length, const std::string& raw, Type type)
-		: line(line), column(column), offset(offset), length(length), raw(raw), type(type) {}
+		Token(uint32_t line, uint32_t column, size_t offset, std::string_view raw, Type type) noexcept
+		: line(line), column(column), offset(offset), length(raw.length()), type(type), raw(raw) {}
 
 		std::string quoted() const {
-			return "'" + raw + "'";
+			return "'" + std::string {raw} + "'";
 		}
 
 	};
@@ -1,9 +1,6 @@
 #include "tokenizer.hpp"
 #include "util.hpp"
 
-// private library
-#include <regex>
-
 #define SKIP(count) i += (count); column += (count);
 
 namespace tasml {
@@ -27,53 +24,224 @@ namespace tasml {
 		return is_symbol(chr) || is_operator(chr);
 	}
 
-	static Token::Type categorize(const std::string& raw) {
-		static const std::regex floating_re {R"(^\d+\.\d+$)"};
-		static const std::regex integer_re {R"(^[-+]?(([0-9]+)|(0x[0-9a-fA-F]+)|(0b[01]+)|(0o[0-7]+))$)"};
-		static const std::regex string_re {R"(^".*"$)"};
-		static const std::regex name_re {R"(^[A-Za-z_.$](\w|[.$])*$)"};
-		static const std::regex label_re {R"(^[A-Za-z_.$](\w|[.$])*:$)"};
-		static const std::regex reference_re {R"(^@[A-Za-z_.$](\w|[.$])*$)"};
-
-		if (std::regex_match(raw, floating_re)) return Token::FLOAT;
-		if (std::regex_match(raw, integer_re)) return Token::INT;
-		if (std::regex_match(raw, string_re)) return Token::STRING;
-		if (std::regex_match(raw, name_re)) return Token::NAME;
-		if (std::regex_match(raw, label_re)) return Token::LABEL;
-		if (std::regex_match(raw, reference_re)) return Token::REFERENCE;
-
-		if (raw.length() == 1) {
-			char chr = raw[0];
-
-			if (is_symbol(chr)) return Token::SYMBOL;
-			if (is_operator(chr)) return Token::OPERATOR;
+	/*
+	 * Token classification automaton
+	 *
+	 * Each character appended to a token advances the automaton by one transition,
+	 * so that once the token ends its type can be read directly from the accepting state.
+	 * The automaton recognizes the same language as the old regular expressions:
+	 *
+	 * FLOAT     \d+\.\d+
+	 * INT       [-+]?(([0-9]+)|(0x[0-9a-fA-F]+)|(0b[01]+)|(0o[0-7]+))
+	 * STRING    ".*"
+	 * NAME      [A-Za-z_.$](\w|[.$])*
+	 * LABEL     [A-Za-z_.$](\w|[.$])*:
+	 * REFERENCE @[A-Za-z_.$](\w|[.$])*
+	 */
+
+	enum CharClass : uint8_t {
+		C_OTHER,
+		C_ZERO,     // 0
+		C_ONE,      // 1
+		C_OCTAL,    // 2-7
+		C_DECIMAL,  // 8-9
+		C_B,        // b, both a hex digit and the binary prefix
+		C_O,        // o, the octal prefix
+		C_X,        // x, the hex prefix
+		C_HEX,      // remaining hex digits
+		C_ALPHA,    // remaining name characters
+		C_DOT,
+		C_COLON,
+		C_AT,
+		C_QUOTE,
+		C_SIGN,     // + and -
+		C_SYMBOL,
+		C_OPERATOR,
+		C_NEWLINE,  // not matched by '.' in the string pattern
+		CHAR_CLASSES
+	};
+
+	enum State : uint8_t {
+		S_REJECT,
+		S_START,
+		S_SIGN,
+		S_ZERO,
+		S_DECIMAL,
+		S_SIGNED_ZERO,
+		S_SIGNED_DECIMAL,
+		S_FRACTION_DOT,
+		S_FRACTION,
+		S_HEX_PREFIX,
+		S_HEX,
+		S_BIN_PREFIX,
+		S_BIN,
+		S_OCT_PREFIX,
+		S_OCT,
+		S_NAME,
+		S_LABEL,
+		S_AT,
+		S_REFERENCE,
+		S_STRING,
+		S_STRING_END,
+		S_SYMBOL,
+		S_OPERATOR,
+		STATES
+	};
+
+	static constexpr auto char_classes = [] {
+		std::array<CharClass, 256> classes {};
+
+		for (int chr = 0; chr < 256; chr ++) {
+			CharClass& cls = classes[chr];
+
+			if (chr == '0') cls = C_ZERO;
+			else if (chr == '1') cls = C_ONE;
+			else if (chr >= '2' && chr <= '7') cls = C_OCTAL;
+			else if (chr == '8' || chr == '9') cls = C_DECIMAL;
+			else if (chr == 'b') cls = C_B;
+			else if (chr == 'o') cls = C_O;
+			else if (chr == 'x') cls = C_X;
+			else if ((chr >= 'a' && chr <= 'f') || (chr >= 'A' && chr <= 'F')) cls = C_HEX;
+			else if ((chr >= 'a' && chr <= 'z') || (chr >= 'A' && chr <= 'Z') || chr == '_' || chr == '$') cls = C_ALPHA;
+			else if (chr == '.') cls = C_DOT;
+			else if (chr == ':') cls = C_COLON;
+			else if (chr == '@') cls = C_AT;
+			else if (chr == '"') cls = C_QUOTE;
+			else if (chr == '+' || chr == '-') cls = C_SIGN;
+			else if (is_symbol((char) chr)) cls = C_SYMBOL;
+			else if (is_operator((char) chr)) cls = C_OPERATOR;
+			else if (chr == '\n' || chr == '\r') cls = C_NEWLINE;
+			else cls = C_OTHER;
+		}
+
+		return classes;
+	} ();
+
+	static constexpr auto transitions = [] {
+		std::array<std::array<State, CHAR_CLASSES>, STATES> table {};
+
+		auto set = [&] (State from, std::initializer_list<CharClass> classes, State to) {
+			for (CharClass cls : classes) table[from][cls] = to;
+		};
+
+		const std::initializer_list<CharClass> nonzero = {C_ONE, C_OCTAL, C_DECIMAL};
+		const std::initializer_list<CharClass> digits = {C_ZERO, C_ONE, C_OCTAL, C_DECIMAL};
+		const std::initializer_list<CharClass> hex = {C_ZERO, C_ONE, C_OCTAL, C_DECIMAL, C_B, C_HEX};
+		const std::initializer_list<CharClass> leading = {C_B, C_O, C_X, C_HEX, C_ALPHA, C_DOT};
+		const std::initializer_list<CharClass> trailing = {C_ZERO, C_ONE, C_OCTAL, C_DECIMAL, C_B, C_O, C_X, C_HEX, C_ALPHA, C_DOT};
+
+		set(S_START, {C_ZERO}, S_ZERO);
+		set(S_START, nonzero, S_DECIMAL);
+		set(S_START, leading, S_NAME);
+		set(S_START, {C_AT}, S_AT);
+		set(S_START, {C_QUOTE}, S_STRING);
+		set(S_START, {C_SIGN}, S_SIGN);
+		set(S_START, {C_SYMBOL}, S_SYMBOL);
+		set(S_START, {C_OPERATOR}, S_OPERATOR);
+
+		// integers, floating point values can't have a sign
+		set(S_SIGN, {C_ZERO}, S_SIGNED_ZERO);
+		set(S_SIGN, nonzero, S_SIGNED_DECIMAL);
+		set(S_ZERO, digits, S_DECIMAL);
+		set(S_ZERO, {C_DOT}, S_FRACTION_DOT);
+		set(S_ZERO, {C_X}, S_HEX_PREFIX);
+		set(S_ZERO, {C_B}, S_BIN_PREFIX);
+		set(S_ZERO, {C_O}, S_OCT_PREFIX);
+		set(S_DECIMAL, digits, S_DECIMAL);
+		set(S_DECIMAL, {C_DOT}, S_FRACTION_DOT);
+		set(S_SIGNED_ZERO, digits, S_SIGNED_DECIMAL);
+		set(S_SIGNED_ZERO, {C_X}, S_HEX_PREFIX);
+		set(S_SIGNED_ZERO, {C_B}, S_BIN_PREFIX);
+		set(S_SIGNED_ZERO, {C_O}, S_OCT_PREFIX);
+		set(S_SIGNED_DECIMAL, digits, S_SIGNED_DECIMAL);
+		set(S_FRACTION_DOT, digits, S_FRACTION);
+		set(S_FRACTION, digits, S_FRACTION);
+		set(S_HEX_PREFIX, hex, S_HEX);
+		set(S_HEX, hex, S_HEX);
+		set(S_BIN_PREFIX, {C_ZERO, C_ONE}, S_BIN);
+		set(S_BIN, {C_ZERO, C_ONE}, S_BIN);
+		set(S_OCT_PREFIX, {C_ZERO, C_ONE, C_OCTAL}, S_OCT);
+		set(S_OCT, {C_ZERO, C_ONE, C_OCTAL}, S_OCT);
+
+		// names, labels and references
+		set(S_NAME, trailing, S_NAME);
+		set(S_NAME, {C_COLON}, S_LABEL);
+		set(S_AT, leading, S_REFERENCE);
+		set(S_REFERENCE, trailing, S_REFERENCE);
+
+		// strings, anything goes as long as it's on one line
+		for (int cls = 0; cls < CHAR_CLASSES; cls ++) {
+			if (cls != C_NEWLINE) {
+				table[S_STRING][cls] = (cls == C_QUOTE) ? S_STRING_END : S_STRING;
+				table[S_STRING_END][cls] = (cls == C_QUOTE) ? S_STRING_END : S_STRING;
+			}
 		}
 
-		return Token::INVALID;
+		return table;
+	} ();
+
+	static constexpr auto accepting = [] {
+		std::array<Token::Type, STATES> types {};
+
+		types[S_SIGN] = Token::OPERATOR;
+		types[S_ZERO] = Token::INT;
+		types[S_DECIMAL] = Token::INT;
+		types[S_SIGNED_ZERO] = Token::INT;
+		types[S_SIGNED_DECIMAL] = Token::INT;
+		types[S_FRACTION] = Token::FLOAT;
+		types[S_HEX] = Token::INT;
+		types[S_BIN] = Token::INT;
+		types[S_OCT] = Token::INT;
+		types[S_NAME] = Token::NAME;
+		types[S_LABEL] = Token::LABEL;
+		types[S_REFERENCE] = Token::REFERENCE;
+		types[S_STRING_END] = Token::STRING;
+		types[S_SYMBOL] = Token::SYMBOL;
+		types[S_OPERATOR] = Token::OPERATOR;
+
+		return types;
+	} ();
+
+	static constexpr State advance(State state, char chr) {
+		return transitions[state][char_classes[(uint8_t) chr]];
 	}
 
-	std::vector<Token> tokenize(ErrorHandler& reporter, const std::string& input) {
+	Tokenizer::Tokenizer(ErrorHandler& reporter)
+	: reporter(reporter) {}
+
+	void Tokenizer::scan(std::vector<Token>& tokens, std::string_view input, long base, bool last) {
 
+		// the input is a window of the source, starting at the global offset 'base',
+		// the token being scanned is always a contiguous slice of the source
+		// that starts at 'begin', or is empty if 'begin' is negative
 		long size = (long) input.size();
-		int32_t line = 1, column = 0, start = 0, offset = 0;
+		State state = static_cast<State>(this->state);
 
-		std::vector<Token> tokens;
-		std::string token = "";
+		auto append = [&] (long index) {
+			if (begin < 0) {
+				begin = base + index;
+				state = S_START;
+			}
 
-		bool in_string = false;
-		bool in_comment = false;
-		bool in_multiline_comment = false;
+			state = advance(state, input[index]);
+		};
 
-		auto submit = [&] (const std::string& raw, bool silent = false) {
-			Token::Type type = categorize(raw);
+		auto submit = [&] (long end, bool silent = false) {
+			const std::string_view raw = input.substr(begin - base, base + end - begin);
+			const Token::Type type = accepting[state];
 			tokens.emplace_back(line, start, offset, raw, type);
 
 			if (type == Token::INVALID && !silent) {
-				reporter.error(line, start, "Unknown token '" + raw + "'");
+				reporter.error(line, start, "Unknown token '" + std::string {raw} + "'");
+				failed = true;
 			}
+
+			begin = -1;
 		};
 
-		for (long i = 0; i < size; i ++) {
+		long i = position - base;
+
+		for (; i < size; i ++) {
 			column ++;
 
 			char c = input[i];
@@ -82,19 +250,18 @@ namespace tasml {
 			if (c == '\n') {
 				if (in_string) {
 					reporter.error(line, start, "Unexpected end of line, expected end of string");
-					submit(token, true);
+					submit(i, true);
+					failed = true;
 					in_string = false;
-					token = "";
 				}
 
-				if (!token.empty()) {
-					submit(token);
+				if (begin >= 0) {
+					submit(i);
 				}
 
 				line ++;
 				column = 0;
 				in_comment = false;
-				token = "";
 				continue;
 			}
 
@@ -106,7 +273,6 @@ namespace tasml {
 				if (c == '*' && n == '/') {
 					// End of multi-line comment
 					in_multiline_comment = false;
-					token = "";
 					SKIP(1); // Skip over the '/' character
 				}
 
@@ -116,28 +282,30 @@ namespace tasml {
 			// handle strings
 			if (c == '"') {
 				in_string = !in_string;
-				token += c;
+				append(i);
 
 				if (!in_string) {
-					submit(token);
-					token = "";
+					submit(i + 1);
 				}
 
 				start = column;
-				offset = i;
+				offset = base + i;
 				continue;
 			}
 
 			// add string content
 			if (in_string) {
-				token += c;
+				append(i);
 
 				if (c == '\\') {
 					if (Token::get_escaped(n) == -1) {
 						reporter.warn(line, column, "Unknown escape code '\\" + std::string {n} + "' used in string");
 					}
 
-					token += n;
+					if (i + 1 < size) {
+						append(i + 1);
+					}
+
 					SKIP(1); // skip the escaped char
 				}
 				continue;
@@ -146,9 +314,8 @@ namespace tasml {
 			// handle operators and end tokens
 			if (is_space(c) || is_break(c) || (c == '/' && n == '/') || (c == '/' && n == '*')) {
 
-				if (!token.empty()) {
-					submit(token);
-					token = "";
+				if (begin >= 0) {
+					submit(i);
 				}
 
 				// inline comment start
@@ -166,27 +333,34 @@ namespace tasml {
 
 				if (!is_space(c)) {
 					start = column;
-					offset = i;
+					offset = base + i;
+					append(i);
 
 					if ((c == '-' || c == '+') && !is_space(n)) {
-						token += c;
 						continue;
 					}
 
-					submit({c});
+					submit(i + 1);
 				}
 
 			} else {
-				if (token.empty()) {
+				if (begin < 0) {
 					start = column;
-					offset = i;
+					offset = base + i;
 				}
 
-				token += c;
+				append(i);
 			}
 
 		}
 
+		position = base + i;
+		this->state = state;
+
+		if (!last) {
+			return;
+		}
+
 		// behave as if there was an extra whitespace at the end
 		column ++;
 
@@ -196,16 +370,20 @@ namespace tasml {
 
 		if (in_string) {
 			reporter.error(line, start, "Unexpected end of input, expected end of string");
-			submit(token, true);
-			token = "";
+			submit(size, true);
+			failed = true;
 		}
 
-		if (!token.empty()) {
-			submit(token);
+		if (begin >= 0) {
+			submit(size);
 		}
 
-		return tokens;
+	}
 
+	std::vector<Token> tokenize(ErrorHandler& reporter, std::string_view input) {
+		std::vector<Token> tokens;
+		Tokenizer {reporter}.scan(tokens, input, 0, true);
+		return tokens;
 	}
 
-}
\ No newline at end of file
+}
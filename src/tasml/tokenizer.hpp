@@ -6,6 +6,46 @@
 
 namespace tasml {
 
-	std::vector<Token> tokenize(ErrorHandler& reporter, const std::string &input);
+	/// Incremental tokenizer, the source can be given in consecutive pieces with the
+	/// scanning state carried over between them, every piece but the last one needs to end with a line break
+	class Tokenizer {
 
-}
\ No newline at end of file
+		private:
+
+			ErrorHandler& reporter;
+
+			int32_t line = 1, column = 0, start = 0;
+			long offset = 0;
+			long position = 0; // global offset of the next character to scan
+			long begin = -1;   // global offset of the unfinished token, or negative if there is none
+			uint8_t state = 0;
+			bool failed = false;
+
+			bool in_string = false;
+			bool in_comment = false;
+			bool in_multiline_comment = false;
+
+		public:
+
+			explicit Tokenizer(ErrorHandler& reporter);
+
+			/// Scan the given piece of the source that starts at the global offset 'base', the piece needs
+			/// to contain all the text from retained() onward, returned tokens point into the piece
+			void scan(std::vector<Token>& tokens, std::string_view input, long base, bool last);
+
+			/// Global offset of the first character that still needs to be given to the next scan() call
+			long retained() const {
+				return begin >= 0 ? begin : position;
+			}
+
+			/// Returns true if no invalid tokens were found so far
+			bool ok() const {
+				return !failed;
+			}
+
+	};
+
+	/// Split the input into tokens, the returned tokens point into the input so it needs to outlive them
+	std::vector<Token> tokenize(ErrorHandler& reporter, std::string_view input);
+
+}
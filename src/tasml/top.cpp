@@ -5,23 +5,27 @@
 
 #include "tokenizer.hpp"
 
+#define STREAM_CHUNK (64 * 1024)
+
 namespace tasml {
 
-	void assemble(ErrorHandler& reporter, TokenStream& stream, asmio::SegmentedBuffer& buffer) {
+	static bool is_lang(const Token& token) {
+		return token.raw == "lang" || token.raw == "language";
+	}
 
-		using namespace asmio;
+	static void assemble(ErrorHandler& reporter, TokenStream& stream, asmio::SegmentedBuffer& buffer, asmio::Module*& module) {
 
-		Module* module = modules.at(Module::base_module).get();
+		using namespace asmio;
 
 		while (!stream.empty()) {
 
 			if (stream.accept("language") || stream.accept("lang")) {
 				const Token& name = stream.expect(Token::NAME);
 
-				auto it = modules.find(name.raw);
+				auto it = modules.find(std::string {name.raw});
 
 				if (it == modules.end()) {
-					throw std::runtime_error {"No such module '" + name.raw + "' defined!"};
+					throw std::runtime_error {"No such module '" + std::string {name.raw} + "' defined!"};
 				}
 
 				module = it->second.get();
@@ -48,7 +52,89 @@ namespace tasml {
 
 	}
 
-	asmio::SegmentedBuffer assemble(ErrorHandler& reporter, const std::string& source) {
+	void assemble(ErrorHandler& reporter, TokenStream& stream, asmio::SegmentedBuffer& buffer) {
+		asmio::Module* module = asmio::modules.at(asmio::Module::base_module).get();
+		assemble(reporter, stream, buffer, module);
+	}
+
+	asmio::SegmentedBuffer assemble(ErrorHandler& reporter, std::istream& input, bool relax) {
+
+		Tokenizer tokenizer {reporter};
+		asmio::SegmentedBuffer buffer;
+		buffer.set_relaxation(relax);
+		asmio::Module* module = asmio::modules.at(asmio::Module::base_module).get();
+
+		// the text window starts at the global offset 'base', it holds at most
+		// one chunk of input plus the unfinished line from the previous chunk
+		std::string text;
+		long base = 0;
+
+		// tokens that still wait for the rest of their statement
+		std::vector<Token> tokens, pending;
+		bool last = false;
+
+		while (!last) {
+
+			const size_t size = text.size();
+			text.resize(size + STREAM_CHUNK);
+			input.read(text.data() + size, STREAM_CHUNK);
+			text.resize(size + input.gcount());
+			last = !input;
+
+			// the text could have moved, point the pending tokens at the new copy
+			tokens.clear();
+
+			for (const Token& token : pending) {
+				tokens.emplace_back(token.line, token.column, token.offset, std::string_view {text}.substr(token.offset - base, token.length), token.type);
+			}
+
+			// only give complete lines to the tokenizer
+			const size_t cut = last ? text.size() : text.rfind('\n') + 1;
+
+			if (cut == 0 && !last) {
+				continue;
+			}
+
+			tokenizer.scan(tokens, std::string_view {text}.substr(0, cut), base, last);
+			long ready = tokens.size();
+
+			// module name could still follow on the next line
+			if (!last && ready > 0 && is_lang(tokens[ready - 1])) {
+				ready --;
+			}
+
+			// once tokenization failed keep going only to report the remaining tokenizer errors
+			if (tokenizer.ok()) {
+				TokenStream stream {tokens, -1, ready, "input"};
+				assemble(reporter, stream, buffer, module);
+			}
+
+			pending.clear();
+
+			for (long i = ready; i < (long) tokens.size(); i ++) {
+				pending.push_back(tokens[i]);
+			}
+
+			// drop the text that was already consumed
+			const long keep = pending.empty() ? tokenizer.retained() : std::min<long>(tokenizer.retained(), pending.front().offset);
+			text.erase(0, keep - base);
+			base = keep;
+
+		}
+
+		if (!tokenizer.ok()) {
+			throw std::runtime_error {"Failed to tokenize input"};
+		}
+
+		if (!reporter.ok()) {
+			throw std::runtime_error {"Failed to parse input"};
+		}
+
+		return buffer;
+
+	}
+
+	asmio::SegmentedBuffer assemble(ErrorHandler& reporter, std::string_view source, bool relax) {
 
 		// tokenize input
 		std::vector<Token> tokens = tokenize(reporter, source);
@@ -60,6 +146,7 @@ namespace tasml {
 
 		// parse and assemble
 		asmio::SegmentedBuffer buffer;
+		buffer.set_relaxation(relax);
 		assemble(reporter, stream, buffer);
 
 		if (!reporter.ok()) {
@@ -70,7 +157,7 @@ namespace tasml {
 
 	}
 
-	asmio::SegmentedBuffer assemble(const char* unit, const std::string& source) {
+	asmio::SegmentedBuffer assemble(const char* unit, std::string_view source) {
 
 		ErrorHandler reporter {unit, true};
 
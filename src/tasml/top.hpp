@@ -9,9 +9,14 @@ namespace tasml {
 
 	void assemble(ErrorHandler& reporter, TokenStream& stream, asmio::SegmentedBuffer& buffer);
 
-	asmio::SegmentedBuffer assemble(ErrorHandler& reporter, const std::string& source);
+	/// Assemble the given source, with 'relax' set label jumps will be emitted in the shortest form that fits
+	asmio::SegmentedBuffer assemble(ErrorHandler& reporter, std::string_view source, bool relax = false);
+
+	/// Assemble the input as it is being read, statement by statement, so that the whole
+	/// source and all its tokens never need to be held in memory at once
+	asmio::SegmentedBuffer assemble(ErrorHandler& reporter, std::istream& input, bool relax = false);
 
 	/// This is used as a helper by the tests, assemble and print errors
-	asmio::SegmentedBuffer assemble(const char* unit, const std::string& source);
+	asmio::SegmentedBuffer assemble(const char* unit, std::string_view source);
 
 }
@@ -53,6 +53,12 @@ namespace asmio::util {
 		return divide_up(a, alignment) * alignment;
 	}
 
+	/// Align 'a' down to a multiple of 'alignment'
+	template <std::integral T>
+	constexpr auto align_down(T a, T alignment) {
+		return (a / alignment) * alignment;
+	}
+
 	/// Compute the number that needs to be added to 'a' so that it is a multiple of 'alignment'
 	template <std::integral T>
 	constexpr auto align_padding(T a, T alignment) {
@@ -106,7 +112,8 @@ namespace asmio::util {
 		return false;
 	}
 
-	inline std::string to_lower(std::string s) {
+	inline std::string to_lower(std::string_view view) {
+		std::string s {view};
 		std::ranges::transform(s, s.begin(), [] (const int c) noexcept -> int { return std::tolower(c); });
 		return s;
 	}
@@ -217,32 +224,27 @@ namespace asmio::util {
 		throw std::runtime_error {"Invalid digit '" + std::string(1, c) + "'"};
 	}
 
-	constexpr int64_t parse_int(const char* str) {
+	constexpr int64_t parse_int(std::string_view str) {
 
 		int base = 10;
-		size_t length = strlen(str);
 		int64_t sign = 1;
 
-		if (str[0] == '+') {
-			str ++;
-		} else if (str[0] == '-') {
-			str ++;
+		if (str.starts_with('+')) {
+			str.remove_prefix(1);
+		} else if (str.starts_with('-')) {
+			str.remove_prefix(1);
 			sign = -1;
 		}
 
-		if (length > 2 && str[0] == '0') {
-			if (str[1] == 'x') { str += 2; base = 16; }
-			else if (str[1] == 'o') { str += 2; base = 8;  }
-			else if (str[1] == 'b') { str += 2; base = 2;  }
+		if (str.length() > 2 && str[0] == '0') {
+			if (str[1] == 'x') { str.remove_prefix(2); base = 16; }
+			else if (str[1] == 'o') { str.remove_prefix(2); base = 8;  }
+			else if (str[1] == 'b') { str.remove_prefix(2); base = 2;  }
 		}
 
-		// update length as we could have changed starting point
-		length = strlen(str);
 		int64_t value = 0;
 
-		for (size_t i = 0; i < length; i ++) {
-			char c = str[i];
-
+		for (char c : str) {
 			if (c == '\'' || c == '_') {
 				continue;
 			}
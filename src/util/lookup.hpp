@@ -0,0 +1,108 @@
+#pragma once
+
+#include "external.hpp"
+
+namespace asmio::util {
+
+	template <typename T>
+	struct NameEntry {
+		std::string_view name; // lower case
+		T value;
+	};
+
+	/// Case-insensitive compile time map from short names to values,
+	/// lookups use a single open addressing probe sequence and never allocate
+	template <typename T, size_t N>
+	class NameTable {
+
+		private:
+
+			static constexpr size_t SLOTS = std::bit_ceil(N * 2);
+
+			std::array<NameEntry<T>, N> entries;
+			std::array<uint16_t, SLOTS> slots {}; // entry index + 1, zero marks an empty slot
+
+			static constexpr char fold(char chr) {
+				return (chr >= 'A' && chr <= 'Z') ? static_cast<char>(chr + ('a' - 'A')) : chr;
+			}
+
+			static constexpr size_t hash(std::string_view name) {
+				uint64_t hash = 0xcbf29ce484222325;
+
+				for (char chr : name) {
+					hash = (hash ^ static_cast<uint8_t>(fold(chr))) * 0x100000001b3;
+				}
+
+				return (hash ^ (hash >> 32)) & (SLOTS - 1);
+			}
+
+			static constexpr bool matches(std::string_view name, std::string_view lower) {
+				if (name.size() != lower.size()) {
+					return false;
+				}
+
+				for (size_t i = 0; i < name.size(); i ++) {
+					if (fold(name[i]) != lower[i]) return false;
+				}
+
+				return true;
+			}
+
+			template <size_t... I>
+			consteval NameTable(const NameEntry<T> (&list)[N], std::index_sequence<I...>)
+			: entries {list[I]...} {
+
+				for (size_t i = 0; i < N; i ++) {
+					const std::string_view name = entries[i].name;
+
+					for (char chr : name) {
+						if (chr != fold(chr)) throw std::logic_error {"Names need to be given in lower case"};
+					}
+
+					size_t slot = hash(name);
+
+					while (slots[slot] != 0) {
+						if (entries[slots[slot] - 1].name == name) throw std::logic_error {"Duplicate name in table"};
+						slot = (slot + 1) & (SLOTS - 1);
+					}
+
+					slots[slot] = static_cast<uint16_t>(i + 1);
+				}
+			}
+
+		public:
+
+			consteval NameTable(const NameEntry<T> (&list)[N])
+			: NameTable(list, std::make_index_sequence<N> {}) {}
+
+			/// Find the value with the given name, ignoring case, returns nullptr if there is none
+			constexpr const T* find(std::string_view name) const {
+				size_t slot = hash(name);
+
+				while (slots[slot] != 0) {
+					const NameEntry<T>& entry = entries[slots[slot] - 1];
+
+					if (matches(name, entry.name)) {
+						return &entry.value;
+					}
+
+					slot = (slot + 1) & (SLOTS - 1);
+				}
+
+				return nullptr;
+			}
+
+			/// Number of names in this table
+			constexpr size_t size() const {
+				return N;
+			}
+
+	};
+
+	/// Create a NameTable, for example 'name_table<int>({{"one", 1}, {"two", 2}})'
+	template <typename T, size_t N>
+	consteval NameTable<T, N> name_table(const NameEntry<T> (&list)[N]) {
+		return {list};
+	}
+
+}
@@ -0,0 +1,67 @@
+#include "mapped.hpp"
+
+#include <external.hpp>
+
+namespace asmio::util {
+
+	/*
+	 * class MappedFile
+	 */
+
+	MappedFile::MappedFile(const std::string& path) {
+
+		const int fd = open(path.c_str(), O_RDONLY);
+
+		if (fd == -1) {
+			return;
+		}
+
+		struct stat info {};
+
+		if (fstat(fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0) {
+			void* address = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+			if (address != MAP_FAILED) {
+				mapping = address;
+				length = info.st_size;
+				loaded = true;
+
+				// the tokenizer reads the file front to back, exactly once
+				madvise(mapping, length, MADV_SEQUENTIAL);
+				close(fd);
+				return;
+			}
+		}
+
+		// can't map the file, read it in large blocks instead
+		char block[64 * 1024];
+		ssize_t count;
+
+		while ((count = read(fd, block, sizeof(block))) > 0) {
+			fallback.append(block, count);
+		}
+
+		loaded = (count == 0);
+		close(fd);
+
+	}
+
+	MappedFile::~MappedFile() {
+		if (mapping != nullptr) {
+			munmap(mapping, length);
+		}
+	}
+
+	bool MappedFile::is_open() const {
+		return loaded;
+	}
+
+	std::string_view MappedFile::view() const {
+		if (mapping != nullptr) {
+			return {static_cast<const char*>(mapping), length};
+		}
+
+		return fallback;
+	}
+
+}
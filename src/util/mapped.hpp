@@ -0,0 +1,32 @@
+#pragma once
+#include <string>
+#include <string_view>
+
+namespace asmio::util {
+
+	/// Read-only view of a whole file, the file is memory mapped when possible,
+	/// files that can't be mapped (like pipes) are instead read into memory
+	class MappedFile {
+
+		private:
+
+			bool loaded = false;
+			void* mapping = nullptr;
+			size_t length = 0;
+			std::string fallback;
+
+		public:
+
+			MappedFile(const std::string& path);
+			MappedFile(const MappedFile& other) = delete;
+			~MappedFile();
+
+			/// Check if the file was successfully opened
+			bool is_open() const;
+
+			/// Get the content of the file, valid for as long as this object lives
+			std::string_view view() const;
+
+	};
+
+}
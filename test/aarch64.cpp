@@ -6,6 +6,7 @@
 #include "vstl.hpp"
 #include "asm/aarch64/writer.hpp"
 #include "out/buffer/executable.hpp"
+#include "out/buffer/cache.hpp"
 #include <tasml/top.hpp>
 #include <util/tmp.hpp>
 
@@ -44,6 +45,35 @@ namespace test {
 
 	};
 
+	TEST (tasml_check_aarch64_register_names) {
+
+		SegmentedBuffer expected;
+		BufferWriter writer {expected};
+
+		writer.put_mov(X30, X1);
+		writer.put_mov(W7, WZR);
+		writer.put_mov(FP, LR);
+
+		std::string code = R"(
+			lang aarch64
+			mov X30, x1
+			mov w7, WZR
+			mov fp, Lr
+		)";
+
+		SegmentedBuffer segmented = tasml::assemble(vstl_self.name, code);
+		ASSERT(segmented.segments()[0].buffer == expected.segments()[0].buffer);
+
+		tasml::ErrorHandler reporter {vstl_self.name, true};
+
+		EXPECT_THROW(std::runtime_error) {
+			tasml::assemble(reporter, "lang aarch64\n mov x31, x1\n mov x1, xy\n");
+		};
+
+		ASSERT(!reporter.ok());
+
+	};
+
 	TEST (writer_fail_3reg_invalid) {
 
 		SegmentedBuffer segmented;
@@ -147,6 +177,29 @@ namespace test {
 
 	};
 
+	TEST (writer_check_align_nops) {
+
+		SegmentedBuffer segmented;
+		BufferWriter writer {segmented};
+
+		writer.put_ret();
+		writer.align(16);
+		writer.put_byte(0xFF);
+		writer.align(8);
+
+		std::vector<uint8_t> expected = {
+			0xC0, 0x03, 0x5F, 0xD6, // ret
+			0x1F, 0x20, 0x03, 0xD5, // nop
+			0x1F, 0x20, 0x03, 0xD5, // nop
+			0x1F, 0x20, 0x03, 0xD5, // nop
+			0xFF, 0x00, 0x00, 0x00, // the misaligned part after data is zeroed
+			0x1F, 0x20, 0x03, 0xD5, // nop
+		};
+
+		CHECK(segmented.segments()[0].buffer, expected);
+
+	};
+
 	/*
 	 * region Executable
 	 * Begin architecture depended tests for ARM
@@ -184,6 +237,61 @@ namespace test {
 
 	};
 
+	TEST (writer_exec_rejit_same_pages) {
+
+		CodeCache cache {4096};
+
+		// every block reuses the slot of the previous one, so stale instructions would be executed without cache maintenance
+		for (int i = 0; i < 200; i ++) {
+			SegmentedBuffer segmented;
+			BufferWriter writer {segmented};
+
+			writer.put_b("l_skip");
+			writer.put_mov(X0, 0);
+			writer.put_ret();
+			writer.label("l_skip");
+			writer.put_mov(X0, i);
+			writer.put_ret();
+
+			CodeBlock block = cache.append(segmented);
+			CHECK(block.address(), cache.address());
+			CHECK(reinterpret_cast<uint64_t (*)()>(block.address())(), i);
+
+			cache.release(block);
+		}
+
+		for (int i = 0; i < 50; i ++) {
+			SegmentedBuffer segmented;
+			BufferWriter writer {segmented};
+
+			writer.put_mov(X0, i);
+			writer.put_ret();
+
+			CHECK(to_executable(segmented).call_u64(), i);
+		}
+
+	};
+
+	TEST (writer_exec_native_function) {
+
+		SegmentedBuffer segmented;
+		BufferWriter writer {segmented};
+
+		writer.label("l_add");
+		writer.put_add(X0, X0, X1);
+		writer.put_ret();
+
+		// floating point arguments and results are passed in v0
+		writer.label("l_identity");
+		writer.put_ret();
+
+		ExecutableBuffer buffer = to_executable(segmented);
+
+		CHECK(buffer.function<uint64_t(uint64_t, uint64_t)>("l_add")(40, 2), 42);
+		CHECK(buffer.function<double(double)>("l_identity")(1.5), 1.5);
+
+	};
+
 	TEST (writer_exec_movz) {
 
 		SegmentedBuffer segmented;
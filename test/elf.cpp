@@ -9,6 +9,8 @@
 
 #include "util/tmp.hpp"
 #include "out/elf/buffer.hpp"
+#include "out/debug/gdb.hpp"
+#include "out/buffer/executable.hpp"
 #include "test.hpp"
 
 namespace test {
@@ -242,4 +244,65 @@ namespace test {
 
 	};
 
-}
\ No newline at end of file
+	TEST(elf_gdb_symbol_file) {
+
+		SegmentedBuffer buffer;
+		BasicBufferWriter writer {buffer};
+
+		writer.section(BufferSegment::R);
+		writer.label("gdb_data");
+		writer.put_dword(0);
+
+		writer.section(BufferSegment::R | BufferSegment::X);
+		writer.label("gdb_first");
+		writer.put_dword(0);
+		writer.label("gdb_second");
+		writer.put_dword(0);
+		writer.put_dword(0);
+
+		jit_code_entry* previous = __jit_debug_descriptor.first_entry;
+		set_gdb_registration(GdbRegistration::ALWAYS);
+
+		{
+			ExecutableBuffer executable = to_executable(buffer);
+			jit_code_entry* entry = __jit_debug_descriptor.first_entry;
+
+			ASSERT(entry != previous);
+			ASSERT(entry->next_entry == previous);
+			ASSERT(__jit_debug_descriptor.relevant_entry == entry);
+			CHECK(__jit_debug_descriptor.action_flag, JIT_REGISTER_FN);
+
+			util::TempFile temp {".o"};
+			temp.write(std::string(entry->symfile_addr, entry->symfile_size));
+
+			std::string result = call_shell("readelf -a " + temp.path());
+
+			ASSERT(!result.contains("Warning"));
+			ASSERT(!result.contains("Error"));
+
+			std::stringstream address;
+			address << std::hex << std::setw(16) << std::setfill('0') << reinterpret_cast<uint64_t>(executable.address("gdb_first"));
+
+			ASSERT(result.contains("REL (Relocatable file)"));
+			ASSERT(result.contains(".text             PROGBITS         " + address.str()));
+			ASSERT(result.contains("0000000000000000     4 FUNC    GLOBAL DEFAULT    2 gdb_first"));
+			ASSERT(result.contains("0000000000000004     8 FUNC    GLOBAL DEFAULT    2 gdb_second"));
+			ASSERT(!result.contains("gdb_data"));
+		}
+
+		// unregistered once the code is unmapped
+		CHECK(__jit_debug_descriptor.first_entry, previous);
+		CHECK(__jit_debug_descriptor.action_flag, JIT_UNREGISTER_FN);
+
+		set_gdb_registration(GdbRegistration::NEVER);
+
+		{
+			ExecutableBuffer executable = to_executable(buffer);
+			CHECK(__jit_debug_descriptor.first_entry, previous);
+		}
+
+		set_gdb_registration(GdbRegistration::TRACED);
+
+	};
+
+}
@@ -6,9 +6,12 @@
 
 #include <filesystem>
 #include <fstream>
+#include <sstream>
 #include <regex>
 #include <tasml/top.hpp>
+#include <tasml/tokenizer.hpp>
 #include <util/tmp.hpp>
+#include <util/mapped.hpp>
 
 #include "test.hpp"
 #include "vstl.hpp"
@@ -30,6 +33,136 @@ namespace test {
 
 	}
 
+	TEST (util_mapped_file) {
+
+		util::TempFile temp {".asm"};
+		temp.write("lang x86\nnop\n");
+
+		util::MappedFile file {temp.path()};
+		ASSERT(file.is_open());
+		CHECK(file.view(), "lang x86\nnop\n");
+
+		util::TempFile empty {".asm"};
+		empty.write("");
+
+		util::MappedFile nothing {empty.path()};
+		ASSERT(nothing.is_open());
+		CHECK(nothing.view().size(), 0);
+
+		util::MappedFile missing {temp.path() + ".missing"};
+		ASSERT(!missing.is_open());
+
+	};
+
+	TEST (tasml_tokenize_categories) {
+
+		std::string code = R"(
+			start: mov rax, -0x1F ; jmp @.l$1 // comment
+			/* multi
+			   line */ 1.25 0b101 0o17 +7 - "a\"b" ._x0
+		)";
+
+		tasml::ErrorHandler reporter {vstl_self.name, true};
+		std::vector<tasml::Token> tokens = tasml::tokenize(reporter, code);
+
+		ASSERT(reporter.ok());
+		ASSERT(tokens.size() == 15);
+
+		CHECK(tokens[0].raw, "start:");
+		CHECK(tokens[0].type, tasml::Token::LABEL);
+		CHECK(tokens[1].type, tasml::Token::NAME);
+		CHECK(tokens[3].type, tasml::Token::SYMBOL);
+		CHECK(tokens[4].raw, "-0x1F");
+		CHECK(tokens[4].type, tasml::Token::INT);
+		CHECK(tokens[5].type, tasml::Token::SYMBOL);
+		CHECK(tokens[7].raw, "@.l$1");
+		CHECK(tokens[7].type, tasml::Token::REFERENCE);
+		CHECK(tokens[8].type, tasml::Token::FLOAT);
+		CHECK(tokens[8].line, 4);
+		CHECK(tokens[9].type, tasml::Token::INT);
+		CHECK(tokens[10].type, tasml::Token::INT);
+		CHECK(tokens[11].raw, "+7");
+		CHECK(tokens[11].type, tasml::Token::INT);
+		CHECK(tokens[12].type, tasml::Token::OPERATOR);
+		CHECK(tokens[13].as_string(), "a\"b");
+		CHECK(tokens[13].type, tasml::Token::STRING);
+		CHECK(tokens[14].type, tasml::Token::NAME);
+
+		// tokens are views into the source
+		for (const tasml::Token& token : tokens) {
+			CHECK(token.raw.data(), code.data() + token.offset);
+			CHECK(token.length, token.raw.length());
+		}
+
+	};
+
+	TEST (tasml_tokenize_invalid) {
+
+		tasml::ErrorHandler reporter {vstl_self.name, true};
+		std::vector<tasml::Token> tokens = tasml::tokenize(reporter, "-1.5 0x 12ab @1");
+
+		ASSERT(!reporter.ok());
+		ASSERT(tokens.size() == 4);
+
+		for (const tasml::Token& token : tokens) {
+			CHECK(token.type, tasml::Token::INVALID);
+		}
+
+	};
+
+	TEST (tasml_assemble_streamed) {
+
+		// big enough to be split into many chunks, with some statements crossing chunk boundaries
+		std::string code = "lang x86\nsection rx\n";
+
+		for (int i = 0; i < 8000; i ++) {
+			const std::string id = std::to_string(i);
+			code += "l" + id + ": mov rcx, " + id + " /* a\n b */ ; jne @l" + id + "\n";
+			code += (i % 997 == 0) ? "lang\n\nx86\n" : "add rax, [rbx + rcx * 4]; dec rax // " + id + "\n";
+		}
+
+		tasml::ErrorHandler direct {vstl_self.name, true};
+		SegmentedBuffer expected = tasml::assemble(direct, code);
+
+		tasml::ErrorHandler streamed {vstl_self.name, true};
+		std::istringstream input {code};
+		SegmentedBuffer buffer = tasml::assemble(streamed, input);
+
+		ASSERT(direct.ok());
+		ASSERT(streamed.ok());
+		ASSERT(buffer.segments().size() == expected.segments().size());
+
+		for (size_t i = 0; i < buffer.segments().size(); i ++) {
+			CHECK(buffer.segments()[i].name, expected.segments()[i].name);
+			ASSERT(buffer.segments()[i].buffer == expected.segments()[i].buffer);
+		}
+
+		ASSERT(buffer.resolved_labels().size() == expected.resolved_labels().size());
+
+	};
+
+	TEST (tasml_assemble_streamed_errors) {
+
+		std::istringstream tokens {"lang x86\nmov rax, 0x\nnop\n"};
+		tasml::ErrorHandler first {vstl_self.name, true};
+
+		EXPECT_THROW(std::runtime_error) {
+			tasml::assemble(first, tokens);
+		};
+
+		ASSERT(!first.ok());
+
+		std::istringstream statements {"lang x86\nmov rax, rax, rax\nnop\nlang"};
+		tasml::ErrorHandler second {vstl_self.name, true};
+
+		EXPECT_THROW(std::runtime_error) {
+			tasml::assemble(second, statements);
+		};
+
+		ASSERT(!second.ok());
+
+	};
+
 	TEST (tasml_check_basic_error) {
 
 		std::string code = R"(
@@ -112,6 +245,40 @@ namespace test {
 
 	};
 
+	TEST (tasml_check_align) {
+
+		std::string code = R"(
+			lang x86
+			ret
+			align 8
+			ret
+			align 4
+			align 4
+		)";
+
+		SegmentedBuffer buffer = tasml::assemble(vstl_self.name, code);
+
+		std::vector<uint8_t> expected = {
+			0xC3, 0x0F, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00,
+			0xC3, 0x0F, 0x1F, 0x00,
+		};
+
+		CHECK(buffer.segments()[0].buffer, expected);
+
+		// without a language selected the gap is filled with zeros
+		SegmentedBuffer data = tasml::assemble(vstl_self.name, "byte 1\nalign 4\nbyte 2");
+		std::vector<uint8_t> zeroed = {0x01, 0x00, 0x00, 0x00, 0x02};
+
+		CHECK(data.segments()[0].buffer, zeroed);
+
+		tasml::ErrorHandler reporter {vstl_self.name, true};
+
+		EXPECT_THROW(std::runtime_error) {
+			tasml::assemble(reporter, "lang x86\nalign 24");
+		};
+
+	};
+
 	TEST (tasml_check_readme) {
 
 		std::vector<std::string> files {
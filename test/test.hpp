@@ -1,5 +1,8 @@
 #pragma once
 
+#include <string>
+#include <fstream>
+
 namespace test {
 
 	inline std::string call_shell(std::string cmd) {
@@ -18,4 +21,23 @@ namespace test {
 		return out;
 	}
 
-}
\ No newline at end of file
+	/// Get the permissions of the mapping that holds the given address, in the format of /proc/self/maps (for example "r-xp")
+	inline std::string get_protection(const void* address) {
+		std::ifstream maps {"/proc/self/maps"};
+		std::string line;
+
+		const auto value = reinterpret_cast<uintptr_t>(address);
+
+		while (std::getline(maps, line)) {
+			uintptr_t from, to;
+			char perms[5] {};
+
+			if (sscanf(line.c_str(), "%lx-%lx %4s", &from, &to, perms) == 3 && value >= from && value < to) {
+				return perms;
+			}
+		}
+
+		return "";
+	}
+
+}
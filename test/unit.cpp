@@ -6,6 +6,11 @@
 #include <util.hpp>
 #include <out/buffer/label.hpp>
 #include <out/chunk/buffer.hpp>
+#include <out/buffer/segmented.hpp>
+#include <out/buffer/executable.hpp>
+#include <out/perf/perf.hpp>
+#include <fstream>
+#include <sstream>
 
 #include "vstl.hpp"
 
@@ -227,4 +232,291 @@ namespace test {
 	};
 
 
+	TEST (util_segmented_buffer_linkage_kinds) {
+
+		SegmentedBuffer buffer;
+
+		buffer.add_label("start");
+		buffer.fill(4, 0);
+		buffer.add_linkage("end", 0, Linkage::RELATIVE, 2, -2);
+		buffer.fill(2, 0);
+		buffer.add_linkage("start", 0, Linkage::ABSOLUTE, 4, 1);
+		buffer.fill(4, 0);
+		buffer.add_linkage("end", 0, Linkage::ALIGNED, 8, 0, 4);
+		buffer.fill(4, 0);
+		buffer.add_linkage("end", 0, [] (SegmentedBuffer* buffer, const Linkage& linkage, size_t mount) {
+			*buffer->get_pointer(linkage.target) = 0x77;
+		});
+		buffer.fill(4, 0);
+		buffer.add_label("end");
+
+		buffer.align(16);
+		buffer.link(0x1000);
+
+		std::vector<uint8_t> expected = {
+			0x00, 0x00, 0x00, 0x00,
+			0x0c, 0x00,             // end - 4 - 2
+			0x01, 0x10, 0x00, 0x00, // mount + start + 1
+			0x20, 0x00, 0x00, 0x00, // (end - 10) / 4 = 2, at bit 4
+			0x77, 0x00, 0x00, 0x00,
+		};
+
+		CHECK(buffer.segments()[0].buffer, expected);
+
+	};
+
+	TEST (util_perf_output) {
+
+		SegmentedBuffer segmented;
+
+		segmented.use_section(BufferSegment::R, "data");
+		segmented.add_label("data");
+		segmented.fill(16, 0);
+
+		segmented.use_section(BufferSegment::R | BufferSegment::X, "code");
+		segmented.add_label("first");
+		segmented.fill(4, 0xC3);
+		segmented.add_label("second");
+		segmented.add_label(Label::make_unique());
+		segmented.fill(8, 0xC3);
+		segmented.add_export("second", ExportSymbol::PUBLIC, 2);
+
+		const std::string pid = std::to_string(getpid());
+		const std::string map_path = "/tmp/perf-" + pid + ".map";
+		const std::string dump_path = "/tmp/jit-" + pid + ".dump";
+
+		set_perf_output(PERF_MAP | PERF_JITDUMP);
+		ExecutableBuffer buffer = to_executable(segmented);
+		set_perf_output(PERF_NONE);
+
+		std::ifstream map_file {map_path};
+		std::stringstream map;
+		map << map_file.rdbuf();
+
+		std::ifstream dump_file {dump_path, std::ios::binary};
+		std::stringstream dump;
+		dump << dump_file.rdbuf();
+
+		std::remove(map_path.c_str());
+		std::remove(dump_path.c_str());
+
+		std::stringstream expected;
+		expected << std::hex << reinterpret_cast<size_t>(buffer.address("first")) << " 4 first\n";
+		expected << std::hex << reinterpret_cast<size_t>(buffer.address("second")) << " 2 second\n";
+		CHECK(map.str(), expected.str());
+
+		// header, and two code load records with the name and code bytes
+		const std::string content = dump.str();
+		uint32_t magic;
+		memcpy(&magic, content.data(), 4);
+
+		CHECK(magic, 0x4A695444);
+		CHECK(content.size(), 40 + (56 + 6 + 4) + (56 + 7 + 2));
+		ASSERT(content.contains(std::string {"first\0\xC3\xC3\xC3\xC3", 10}));
+		ASSERT(content.contains(std::string {"second\0\xC3\xC3", 9}));
+
+	};
+
+	TEST (util_segmented_buffer_imports) {
+
+		SegmentedBuffer buffer;
+
+		buffer.add_label("start");
+		buffer.add_linkage("outside", 0, Linkage::RELATIVE, 4, -4);
+		buffer.fill(4, 0);
+		buffer.add_linkage("outside", 0, Linkage::ABSOLUTE, 4);
+		buffer.fill(4, 0);
+		buffer.add_linkage("missing", 0, Linkage::ABSOLUTE, 4);
+		buffer.fill(4, 0);
+
+		std::vector<Label> undefined = buffer.undefined_labels();
+		CHECK(undefined.size(), 2);
+
+		buffer.add_import("outside", 0x3000);
+		CHECK(buffer.undefined_labels().size(), 1);
+		ASSERT(!buffer.has_label("outside"));
+
+		EXPECT_THROW(std::runtime_error) {
+			buffer.add_import("start", 0x3000);
+		};
+
+		buffer.align(16);
+		buffer.link(0x1000, [] (const Linkage& linkage, const char* what) {});
+
+		std::vector<uint8_t> expected = {
+			0xfc, 0x1f, 0x00, 0x00, // 0x3000 - 0x1000 - 4
+			0x00, 0x30, 0x00, 0x00, // 0x3000
+			0x00, 0x00, 0x00, 0x00,
+		};
+
+		CHECK(buffer.segments()[0].buffer, expected);
+		CHECK(buffer.resolved_labels().size(), 1);
+
+	};
+
+
+	TEST (util_segmented_buffer_parallel_link) {
+
+		std::vector<std::vector<uint8_t>> results;
+
+		for (size_t workers : {1, 4}) {
+			SegmentedBuffer buffer;
+			buffer.set_link_workers(workers);
+			buffer.add_label("start");
+
+			for (int i = 0; i < 50000; i ++) {
+				buffer.add_linkage((i % 9999 == 0) ? "missing" : "start", 0, Linkage::ABSOLUTE, 4, i);
+				buffer.fill(4, 0);
+			}
+
+			std::vector<int32_t> failed;
+
+			buffer.align(16);
+			buffer.link(0x1000, [&] (const Linkage& linkage, const char* what) {
+				failed.push_back(linkage.addend);
+			});
+
+			std::vector<int32_t> expected = {0, 9999, 19998, 29997, 39996, 49995};
+			CHECK(failed, expected);
+			results.push_back(buffer.segments()[0].buffer);
+		}
+
+		ASSERT(results[0] == results[1]);
+
+	};
+
+	TEST (util_segmented_buffer_parallel_link_exception) {
+
+		SegmentedBuffer buffer;
+		buffer.set_link_workers(4);
+		buffer.add_label("start");
+
+		for (int i = 0; i < 50000; i ++) {
+			buffer.add_linkage("start", 0, Linkage::ABSOLUTE, 4);
+			buffer.fill(4, 0);
+		}
+
+		// exceptions other than std::runtime_error are not given to the handler, they need to reach the caller
+		buffer.add_linkage("start", 0, [] (SegmentedBuffer* buffer, const Linkage& linkage, size_t mount) {
+			throw std::logic_error {"custom linker failure"};
+		});
+
+		buffer.align(16);
+
+		EXPECT_THROW(std::logic_error) {
+			buffer.link(0x1000, [] (const Linkage& linkage, const char* what) {});
+		};
+
+	};
+
+	TEST (util_segmented_buffer_label_handles) {
+
+		Label old = Label::make_unique();
+		std::vector<Label> labels;
+
+		for (int i = 0; i < 3000; i ++) {
+			labels.push_back(Label::make_unique());
+		}
+
+		SegmentedBuffer buffer;
+
+		// first seen in reverse order, and mixed with labels outside of the window
+		for (int i = 2999; i >= 0; i --) {
+			buffer.add_linkage(labels[i], 0, Linkage::ABSOLUTE, 2);
+			buffer.fill(2, 0);
+		}
+
+		buffer.add_linkage(old, 0, Linkage::ABSOLUTE, 2);
+		buffer.fill(2, 0);
+
+		CHECK(buffer.get_handle("text"), buffer.get_handle(Label {std::string {"text"}}));
+		CHECK(buffer.get_handle(labels[7]), buffer.get_handle(labels[7]));
+		ASSERT(buffer.get_handle(old) != buffer.get_handle(labels[0]));
+		ASSERT(!buffer.has_label(labels[0]));
+		ASSERT(!buffer.has_label(old));
+
+		for (int i = 0; i < 3000; i ++) {
+			buffer.add_label(labels[i]);
+			buffer.fill(1, 0);
+		}
+
+		buffer.add_label(old);
+		ASSERT(buffer.has_label(labels[0]));
+		ASSERT(buffer.has_label(old));
+
+		EXPECT_THROW(std::runtime_error) {
+			buffer.add_label(labels[42]);
+		};
+
+		buffer.align(1);
+		buffer.link(0);
+
+		const auto& bytes = buffer.segments()[0].buffer;
+
+		CHECK(bytes[0] | bytes[1] << 8, 6002 + 2999);
+		CHECK(bytes[6000] | bytes[6001] << 8, 6002 + 3000);
+		CHECK(buffer.resolved_labels().size(), 3001);
+
+	};
+
+	TEST (util_segmented_buffer_label_handles_window_growth) {
+
+		std::vector<Label> labels;
+
+		for (int i = 0; i < 6000; i ++) {
+			labels.push_back(Label::make_unique());
+		}
+
+		SegmentedBuffer buffer;
+
+		// the last label is too far ahead of the window when first seen, the window only grows over it later
+		buffer.add_linkage(labels[0], 0, Linkage::ABSOLUTE, 2);
+		buffer.fill(2, 0);
+		buffer.add_linkage(labels[5999], 0, Linkage::ABSOLUTE, 2);
+		buffer.fill(2, 0);
+
+		for (int i = 0; i < 6000; i ++) {
+			buffer.add_label(labels[i]);
+			buffer.fill(1, 0);
+		}
+
+		buffer.add_linkage(labels[5999], 0, Linkage::ABSOLUTE, 2);
+		buffer.fill(2, 0);
+
+		ASSERT(buffer.has_label(labels[5999]));
+		CHECK(buffer.undefined_labels().size(), 0);
+
+		buffer.align(1);
+		buffer.link(0);
+
+		const auto& bytes = buffer.segments()[0].buffer;
+
+		CHECK(bytes[2] | bytes[3] << 8, 4 + 5999);
+		CHECK(bytes[6004] | bytes[6005] << 8, 4 + 5999);
+
+		// the far label is defined before the window grows over it, and only queried afterwards
+		std::vector<Label> others;
+
+		for (int i = 0; i < 7000; i ++) {
+			others.push_back(Label::make_unique());
+		}
+
+		SegmentedBuffer lookup;
+
+		lookup.add_label(others[0]);
+		lookup.add_label(others[5999]);
+		lookup.fill(1, 0);
+		ASSERT(lookup.has_label(others[5999]));
+
+		for (int i = 1; i < 7000; i += 2) {
+			if (i != 5999) lookup.add_label(others[i]);
+		}
+
+		ASSERT(lookup.has_label(others[5999]));
+		ASSERT(!lookup.has_label(others[5998]));
+		CHECK(lookup.get_label(others[5999]).offset, 0);
+		CHECK(lookup.get_label(others[6999]).offset, 1);
+
+	};
+
 }
\ No newline at end of file
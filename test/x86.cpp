@@ -9,7 +9,9 @@
 
 // private libs
 #include <fstream>
+#include <thread>
 #include <out/buffer/executable.hpp>
+#include <out/buffer/cache.hpp>
 #include <tasml/top.hpp>
 #include <util/tmp.hpp>
 
@@ -447,6 +449,314 @@ namespace test {
 
 	}
 
+	TEST (tasml_check_x86_register_names) {
+
+		SegmentedBuffer expected;
+		BufferWriter writer {expected};
+
+		writer.put_mov(R13L, AL);
+		writer.put_mov(R13L, AL);
+		writer.put_inc(SPL);
+		writer.put_mov(ref(RAX + RCX * 4), R15D);
+
+		std::string code = R"(
+			lang x86
+			mov r13l, al
+			mov R13L, Al
+			inc spl
+			mov dword [rax + rcx * 4], R15d
+		)";
+
+		SegmentedBuffer segmented = tasml::assemble(vstl_self.name, code);
+		ASSERT(segmented.segments()[0].buffer == expected.segments()[0].buffer);
+
+		tasml::ErrorHandler reporter {vstl_self.name, true};
+
+		EXPECT_THROW(std::runtime_error) {
+			tasml::assemble(reporter, "lang x86\n inc r31l\n");
+		};
+
+		ASSERT(!reporter.ok());
+
+	}
+
+	TEST (writer_check_sse_operands) {
+
+		SegmentedBuffer buffer;
+		BufferWriter writer {buffer};
+
+		writer.put_movdqa(XMM0, XMM15);
+		writer.put_movdqa(ref(RAX), XMM1);
+		writer.put_addsd(XMM2, ref(RAX + 8));
+		writer.put_movq(RAX, XMM3);
+		writer.put_cvtsi2sd(XMM0, ref<DWORD>(RAX));
+
+		// general purpose registers can't be used in place of vector registers
+		EXPECT_ANY() { writer.put_paddd(EAX, XMM1); };
+		EXPECT_ANY() { writer.put_paddd(XMM1, EAX); };
+		EXPECT_ANY() { writer.put_movdqa(ref(RAX), ref(RDX)); };
+		EXPECT_ANY() { writer.put_pmovmskb(XMM0, XMM1); };
+		EXPECT_ANY() { writer.put_pmovmskb(EAX, ref(RAX)); };
+
+		// size mismatch
+		EXPECT_ANY() { writer.put_movd(XMM0, RAX); };
+		EXPECT_ANY() { writer.put_movq(XMM0, EAX); };
+		EXPECT_ANY() { writer.put_pmovmskb(AX, XMM1); };
+		EXPECT_ANY() { writer.put_cvtsi2sd(XMM0, ref(RAX)); };
+		EXPECT_ANY() { writer.put_cvttsd2si(AX, XMM0); };
+		EXPECT_ANY() { writer.put_pextrd(RAX, XMM0, 1); };
+		EXPECT_ANY() { writer.put_pinsrq(XMM0, EAX, 1); };
+
+		// immediates
+		EXPECT_ANY() { writer.put_pshufd(XMM0, XMM1, XMM2); };
+		EXPECT_ANY() { writer.put_pslldq(XMM0, XMM1); };
+
+	}
+
+	TEST (writer_check_sse_pextrw) {
+
+		SegmentedBuffer buffer;
+		BufferWriter writer {buffer};
+
+		// register destinations use the SSE2 encoding, only the memory one needs SSE4.1
+		writer.put_pextrw(EAX, XMM1, 3);
+		writer.put_pextrw(R10D, XMM9, 3);
+		writer.put_pextrw(ref(RDI), XMM1, 3);
+
+		EXPECT_ANY() { writer.put_pextrw(AX, XMM1, 3); };
+
+		std::vector<uint8_t> expected {
+			0x66, 0x0F, 0xC5, 0xC1, 0x03,
+			0x66, 0x45, 0x0F, 0xC5, 0xD1, 0x03,
+			0x66, 0x0F, 0x3A, 0x15, 0x0F, 0x03,
+		};
+
+		ASSERT(buffer.segments()[0].buffer == expected);
+
+	}
+
+	TEST (tasml_check_sse_register_names) {
+
+		SegmentedBuffer expected;
+		BufferWriter writer {expected};
+
+		writer.put_movdqu(XMM0, ref(RDI));
+		writer.put_pcmpeqb(XMM0, XMM15);
+		writer.put_pmovmskb(EAX, XMM0);
+		writer.put_pshufd(XMM8, XMM0, 0b00011011);
+		writer.put_movsd(XMM1, ref(RSP + 8));
+		writer.put_movsd();
+
+		std::string code = R"(
+			lang x86
+			movdqu xmm0, [rdi]
+			pcmpeqb XMM0, xmm15
+			pmovmskb eax, xmm0
+			pshufd xmm8, xmm0, 0b00011011
+			movsd xmm1, [rsp + 8]
+			movsd
+		)";
+
+		SegmentedBuffer segmented = tasml::assemble(vstl_self.name, code);
+		ASSERT(segmented.segments()[0].buffer == expected.segments()[0].buffer);
+
+	}
+
+	TEST (writer_check_avx_operands) {
+
+		SegmentedBuffer buffer;
+		BufferWriter writer {buffer};
+
+		writer.put_vmovdqu(YMM0, ref(RDI));
+		writer.put_vpaddd(YMM0, YMM1, ref(RAX + 32));
+		writer.put_vaddsd(XMM0, XMM1, ref<QWORD>(RSP));
+		writer.put_vpsrld(YMM0, YMM1, XMM2);
+		writer.put_vpgatherdd(YMM0, ref(RDI + YMM1 * 4), YMM2);
+
+		// general purpose registers can't be used in place of vector registers
+		EXPECT_ANY() { writer.put_vpaddd(EAX, YMM1, YMM2); };
+		EXPECT_ANY() { writer.put_vpaddd(YMM0, EAX, YMM2); };
+		EXPECT_ANY() { writer.put_vmovdqu(ref(RAX), ref(RDX)); };
+		EXPECT_ANY() { writer.put_vpmovmskb(YMM0, YMM1); };
+
+		// size mismatch
+		EXPECT_ANY() { writer.put_vpaddd(YMM0, XMM1, YMM2); };
+		EXPECT_ANY() { writer.put_vpaddd(YMM0, YMM1, XMM2); };
+		EXPECT_ANY() { writer.put_vaddsd(YMM0, YMM1, YMM2); };
+		EXPECT_ANY() { writer.put_vpsrld(YMM0, YMM1, YMM2); };
+
+		// gathers need a vector index and distinct registers
+		EXPECT_ANY() { writer.put_vpgatherdd(YMM0, ref(RDI + RCX * 4), YMM2); };
+		EXPECT_ANY() { writer.put_vpgatherdd(YMM0, ref(RDI + YMM0 * 4), YMM2); };
+		EXPECT_ANY() { writer.put_vpgatherdd(YMM0, ref(RDI + YMM1 * 4), YMM0); };
+
+		// immediates
+		EXPECT_ANY() { writer.put_vpshufd(YMM0, YMM1, YMM2); };
+		EXPECT_ANY() { writer.put_vpslldq(YMM0, YMM1, XMM2); };
+
+	}
+
+	TEST (tasml_check_avx_register_names) {
+
+		SegmentedBuffer expected;
+		BufferWriter writer {expected};
+
+		writer.put_vmovdqu(YMM0, ref(RDI));
+		writer.put_vpcmpeqb(YMM0, YMM0, YMM15);
+		writer.put_vpmovmskb(EAX, YMM0);
+		writer.put_vfmadd231ps(YMM8, YMM1, ref(RSI + 32));
+		writer.put_vpermq(YMM1, YMM2, 0b01001110);
+		writer.put_vzeroupper();
+
+		std::string code = R"(
+			lang x86
+			vmovdqu ymm0, [rdi]
+			vpcmpeqb YMM0, ymm0, ymm15
+			vpmovmskb eax, ymm0
+			vfmadd231ps ymm8, ymm1, [rsi + 32]
+			vpermq ymm1, ymm2, 0b01001110
+			vzeroupper
+		)";
+
+		SegmentedBuffer segmented = tasml::assemble(vstl_self.name, code);
+		ASSERT(segmented.segments()[0].buffer == expected.segments()[0].buffer);
+
+	}
+
+	TEST (writer_check_avx512_operands) {
+
+		SegmentedBuffer buffer;
+		BufferWriter writer {buffer};
+
+		writer.put_vaddps(ZMM0, ZMM1, ZMM2);
+		writer.put_vaddps(mask(ZMM0, K1), ZMM1, broadcast(RAX));
+		writer.put_vpaddd(XMM16, XMM1, ref(RAX + 64));
+		writer.put_vmovdqu32(mask(ref(RDI), K1), ZMM0);
+		writer.put_vpcmpd(mask(K1, K2), ZMM0, ZMM1, 1);
+		writer.put_kandw(K1, K2, K3);
+		writer.put_kmovd(EAX, K1);
+
+		// decorators
+		EXPECT_ANY() { mask(ZMM0, K0); };
+		EXPECT_ANY() { mask(ZMM0, RAX); };
+		EXPECT_ANY() { Location {ZMM0}.broadcasted(); };
+
+		// instructions without an AVX-512 form, and SSE, can't use the new registers
+		EXPECT_ANY() { writer.put_vpand(ZMM0, ZMM1, ZMM2); };
+		EXPECT_ANY() { writer.put_vpand(XMM16, XMM1, XMM2); };
+		EXPECT_ANY() { writer.put_vpand(mask(XMM0, K1), XMM1, XMM2); };
+		EXPECT_ANY() { writer.put_vpmovmskb(EAX, ZMM0); };
+		EXPECT_ANY() { writer.put_addps(XMM16, XMM1); };
+		EXPECT_ANY() { writer.put_vpgatherdd(ZMM0, ref(RDI + ZMM1 * 4), ZMM2); };
+
+		// size mismatch
+		EXPECT_ANY() { writer.put_vaddps(ZMM0, ZMM1, YMM2); };
+		EXPECT_ANY() { writer.put_vaddps(ZMM0, ZMM1, broadcast<QWORD>(RAX)); };
+
+		// not every instruction can broadcast, or zero the masked out elements
+		EXPECT_ANY() { writer.put_vmovups(ZMM0, broadcast(RAX)); };
+		EXPECT_ANY() { writer.put_vaddss(XMM0, XMM1, broadcast(RAX)); };
+		EXPECT_ANY() { writer.put_vmovups(maskz(ref(RDI), K1), ZMM0); };
+		EXPECT_ANY() { writer.put_vpcmpeqd(maskz(K1, K2), ZMM0, ZMM1); };
+
+		// opmask instructions
+		EXPECT_ANY() { writer.put_kandw(K1, ZMM0, K2); };
+		EXPECT_ANY() { writer.put_kmovw(K1, RAX); };
+		EXPECT_ANY() { writer.put_kmovq(K1, EAX); };
+		EXPECT_ANY() { writer.put_kmovb(ref<WORD>(RAX), K1); };
+
+	}
+
+	TEST (tasml_check_avx512_decorators) {
+
+		SegmentedBuffer expected;
+		BufferWriter writer {expected};
+
+		writer.put_vaddps(maskz(ZMM1, K1), ZMM2, broadcast<DWORD>(RAX + 4));
+		writer.put_vmovdqu32(mask(ref(RDI + 64), K7), ZMM31);
+		writer.put_vpcmpd(mask(K1, K2), ZMM0, ZMM1, 6);
+		writer.put_vmovaps(ZMM0, ref<ZWORD>(RSI));
+		writer.put_kortestw(K1, K1);
+
+		std::string code = R"(
+			lang x86
+			vaddps zmm1 {k1}{z}, zmm2, dword bcst [rax + 4]
+			vmovdqu32 [rdi + 64] {k7}, zmm31
+			vpcmpd k1 {k2}, zmm0, zmm1, 6
+			vmovaps zmm0, zword [rsi]
+			kortestw k1, k1
+		)";
+
+		SegmentedBuffer segmented = tasml::assemble(vstl_self.name, code);
+		ASSERT(segmented.segments()[0].buffer == expected.segments()[0].buffer);
+
+	}
+
+	TEST (writer_check_bmi_operands) {
+
+		SegmentedBuffer buffer;
+		BufferWriter writer {buffer};
+
+		writer.put_popcnt(EAX, ECX);
+		writer.put_lzcnt(RAX, ref(RDI));
+		writer.put_andn(EAX, EBX, ref(RSI));
+		writer.put_blsr(R8, ref<QWORD>(RSI));
+		writer.put_rorx(RAX, RBX, 3);
+		writer.put_adcx(R9, ref(RDI + 8));
+
+		// byte operands are not supported, and the VEX encoded ones don't take words either
+		EXPECT_ANY() { writer.put_popcnt(AL, CL); };
+		EXPECT_ANY() { writer.put_andn(AX, BX, CX); };
+		EXPECT_ANY() { writer.put_adox(AX, BX); };
+
+		// size mismatch
+		EXPECT_ANY() { writer.put_andn(EAX, RBX, RCX); };
+		EXPECT_ANY() { writer.put_shlx(RAX, EBX, RCX); };
+		EXPECT_ANY() { writer.put_adcx(EAX, RBX); };
+
+		// the destination and the VEX.vvvv operand need to be registers
+		EXPECT_ANY() { writer.put_andn(ref(RAX), EBX, ECX); };
+		EXPECT_ANY() { writer.put_bextr(EAX, EBX, ref(RCX)); };
+		EXPECT_ANY() { writer.put_blsr(ref(RAX), EBX); };
+		EXPECT_ANY() { writer.put_popcnt(EAX, 12); };
+		EXPECT_ANY() { writer.put_rorx(EAX, EBX, ECX); };
+
+	}
+
+	TEST (writer_check_align_nops) {
+
+		SegmentedBuffer segmented;
+		BufferWriter writer {segmented};
+
+		writer.put_ret();
+		writer.align(16);
+		writer.label("l_head");
+		writer.put_ret();
+		writer.put_ret();
+		writer.put_ret();
+		writer.align(8);
+		writer.align(8);
+		writer.put_ret();
+		writer.align(32);
+
+		std::vector<uint8_t> expected = {
+			0xC3,
+			0x66, 0x0F, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, // 9 byte nop
+			0x66, 0x0F, 0x1F, 0x44, 0x00, 0x00,                   // 6 byte nop
+			0xC3, 0xC3, 0xC3,
+			0x0F, 0x1F, 0x44, 0x00, 0x00,                         // 5 byte nop
+			0xC3,
+			0x0F, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00,             // 7 byte nop
+		};
+
+		CHECK(segmented.segments()[0].buffer, expected);
+		CHECK(segmented.get_label("l_head").offset, 16);
+
+		EXPECT_ANY() { writer.align(0); };
+		EXPECT_ANY() { writer.align(12); };
+
+	}
+
 	/*
 	 * region Executable
 	 * Begin architecture depended tests for x86
@@ -2339,169 +2649,746 @@ namespace test {
 
 	}
 
-	TEST (writer_exec_imul_short) {
+	TEST (writer_exec_relaxed_jmp_forward) {
 
 		SegmentedBuffer segmented;
+		segmented.set_relaxation(true);
 		BufferWriter writer {segmented};
 
-		writer.put_mov(EAX, -3);
-		writer.put_mov(EDX, 4);
-		writer.put_imul(EAX, EDX);
+		writer.put_mov(EAX, 1);
+		writer.put_jmp("l_skip");
+		writer.put_mov(EAX, 2);
+		writer.label("l_skip");
 		writer.put_ret();
 
-		CHECK(to_executable(segmented).call_u32(), -12);
+		ExecutableBuffer buffer = to_executable(segmented);
+
+		CHECK(buffer.call_i32(), 1);
+		CHECK(segmented.segments()[0].buffer.size(), 5 + 2 + 5 + 1);
 
 	}
 
-	TEST (writer_exec_memory_xchg) {
+	TEST (writer_exec_relaxed_export_size) {
 
 		SegmentedBuffer segmented;
+		segmented.set_relaxation(true);
 		BufferWriter writer {segmented};
 
-		writer.label("foo").put_dword(123);
-		writer.label("bar").put_byte(100);
-
-		writer.label("main");
-		writer.put_push(RBX);
-		writer.put_mov(EAX, 33);
-		writer.put_mov(BL, 99);
-		writer.put_xchg(EAX, ref("foo"));
-		writer.put_xchg(ref("bar"), BL);
-		writer.put_pop(RBX);
-		writer.put_ret();
-
-		writer.label("get_foo");
-		writer.put_mov(EAX, ref("foo"));
-		writer.put_ret();
-
-		writer.label("get_bar");
-		writer.put_xor(EAX, EAX);
-		writer.put_mov(AL, ref("bar"));
+		writer.label("l_main");
+		writer.put_mov(EAX, 1);
+		writer.put_jmp("l_skip");
+		for (int i = 0; i < 200; i ++) {
+			writer.put_nop();
+		}
+		writer.label("l_skip");
 		writer.put_ret();
+		writer.export_symbol("l_main", ExportSymbol::PUBLIC, 5 + 2 + 200 + 1);
 
 		ExecutableBuffer buffer = to_executable(segmented);
 
-		CHECK(buffer.call_i32("main"), 123);
-		CHECK(buffer.call_i32("get_foo"), 33);
-		CHECK(buffer.call_i32("get_bar"), 99);
+		CHECK(buffer.call_i32("l_main"), 1);
+		CHECK(segmented.exports()[0].size, 5 + 5 + 200 + 1);
 
 	}
 
-	TEST (writer_exec_memory_push_pop) {
+	TEST (writer_exec_relaxed_cascade) {
 
+		TIMEOUT(1);
 		SegmentedBuffer segmented;
+		segmented.set_relaxation(true);
 		BufferWriter writer {segmented};
 
-		writer.label("foo").put_dword(123);
-		writer.label("bar").put_word(100);
-		writer.label("car").put_dword(0);
+		writer.put_mov(EAX, 0);
+		writer.put_mov(ECX, 3);
 
-		// just to align the disassembly
-		writer.put_byte(0);
+		// the backward jump fits only as long as the forward one stays short
+		writer.label("l_top");
+		writer.put_inc(EAX);
+		writer.put_dec(ECX);
+		writer.put_jz("l_done");
+		for (int i = 0; i < 119; i ++) {
+			writer.put_nop();
+		}
+		writer.put_jmp("l_top");
 
-		writer.label("main");
-		writer.put_push(RBX);
-		writer.put_xor(RBX, RBX);
-		writer.put_mov(RAX, 0);
-		writer.put_push(666);
-		writer.put_mov(RSI, "foo");
-		writer.put_push(ref<QWORD>(RAX + RSI));
-		writer.put_mov(RSI, "bar");
-		writer.put_push(ref<WORD>(RAX + RSI));
-		writer.put_pop(BX);
-		writer.put_pop(RAX);
-		writer.put_mov(RSI, "car");
-		writer.put_pop(ref<QWORD>(RSI));
-		writer.put_add(RAX, RBX);
-		writer.put_pop(RBX);
-		writer.put_ret();
+		for (int i = 0; i < 200; i ++) {
+			writer.put_nop();
+		}
 
-		writer.label("get_car");
-		writer.put_xor(RAX, RAX);
-		writer.put_mov(RSI, "car");
-		writer.put_mov(RAX, ref(RSI));
+		writer.label("l_done");
 		writer.put_ret();
 
 		ExecutableBuffer buffer = to_executable(segmented);
 
-		CHECK(buffer.call_i32("main"), 223);
-		CHECK(buffer.call_i32("get_car"), 666);
+		CHECK(buffer.call_i32(), 3);
+		CHECK(segmented.segments()[0].buffer.size(), 5 + 5 + 2 + 2 + 6 + 119 + 5 + 200 + 1);
 
 	}
 
-	TEST (writer_exec_memory_dec_inc) {
+	TEST (writer_exec_relaxed_section) {
 
 		SegmentedBuffer segmented;
+		segmented.set_relaxation(true);
 		BufferWriter writer {segmented};
 
-		writer.label("ad").put_dword(150);
-		writer.label("bd").put_word(100);
-		writer.label("cd").put_byte(50);
-		writer.label("ai").put_dword(150);
-		writer.label("bi").put_word(100);
-		writer.label("ci").put_byte(50);
-
-		writer.label("main");
-		writer.put_dec(ref<DWORD>("ad"));
-		writer.put_dec(ref<WORD>("bd"));
-		writer.put_dec(ref<BYTE>("cd"));
-		writer.put_inc(ref<DWORD>("ai"));
-		writer.put_inc(ref<WORD>("bi"));
-		writer.put_inc(ref<BYTE>("ci"));
-		writer.put_cmp(ref<DWORD>("ad"), 149);
-		writer.put_jne("invalid");
-		writer.put_cmp(ref<WORD>("bd"), 99);
-		writer.put_jne("invalid");
-		writer.put_cmp(ref<BYTE>("cd"), 49);
-		writer.put_jne("invalid");
-		writer.put_cmp(ref<DWORD>("ai"), 151);
-		writer.put_jne("invalid");
-		writer.put_cmp(ref<WORD>("bi"), 101);
-		writer.put_jne("invalid");
-		writer.put_cmp(ref<BYTE>("ci"), 51);
-		writer.put_jne("invalid");
+		writer.section(BufferSegment::R | BufferSegment::X, "first");
+		writer.label("l_main");
 		writer.put_mov(EAX, 1);
-		writer.put_ret();
+		writer.put_jmp("l_other");
 
-		writer.label("invalid");
-		writer.put_mov(EAX, 0);
+		writer.section(BufferSegment::R | BufferSegment::X, "second");
+		writer.label("l_other");
+		writer.put_add(EAX, 1);
 		writer.put_ret();
 
-		ExecutableBuffer buffer = to_executable(segmented);
-
-		CHECK(buffer.call_i32("main"), 1);
+		CHECK(to_executable(segmented).call_i32("l_main"), 2);
 
 	}
 
-	TEST (writer_exec_memory_neg) {
+	TEST (writer_exec_relaxed_align) {
 
+		TIMEOUT(1);
 		SegmentedBuffer segmented;
+		segmented.set_relaxation(true);
 		BufferWriter writer {segmented};
 
-		writer.label("a").put_dword(150);
-		writer.label("b").put_word(-100);
-		writer.label("c").put_byte(50);
+		writer.put_mov(EAX, 0);
+		writer.put_jmp("l_skip");
+		for (int i = 0; i < 7; i ++) {
+			writer.put_nop();
+		}
 
-		writer.label("main");
-		writer.put_neg(ref<DWORD>("a"));
-		writer.put_neg(ref<WORD>("b"));
-		writer.put_neg(ref<BYTE>("c"));
-		writer.put_cmp(ref<DWORD>("a"), -150);
-		writer.put_jne("invalid");
-		writer.put_cmp(ref<WORD>("b"), 100);
-		writer.put_jne("invalid");
-		writer.put_cmp(ref<BYTE>("c"), -50);
-		writer.put_jne("invalid");
-		writer.put_mov(EAX, 1);
+		// two bytes of padding are written first, once the jump above grows it needs to become fifteen
+		writer.align(16);
+		writer.label("l_loop");
+		writer.put_inc(EAX);
+		writer.put_cmp(EAX, 3);
+		writer.put_jne("l_loop");
 		writer.put_ret();
 
-		writer.label("invalid");
-		writer.put_mov(EAX, 0);
-		writer.put_ret();
+		for (int i = 0; i < 200; i ++) {
+			writer.put_nop();
+		}
+
+		writer.label("l_skip");
+		writer.put_jmp("l_loop");
 
 		ExecutableBuffer buffer = to_executable(segmented);
 
-		CHECK(buffer.call_i32("main"), 1);
+		CHECK(buffer.call_i32(), 3);
+		CHECK(segmented.get_label("l_loop").offset, 32);
+		CHECK(segmented.segments()[0].buffer.size(), 32 + 2 + 6 + 2 + 1 + 200 + 5);
+
+	}
+
+	TEST (writer_exec_code_cache) {
+
+		CodeCache cache {4096};
+		std::vector<CodeBlock> blocks;
+
+		for (int i = 0; i < 20; i ++) {
+			SegmentedBuffer segmented;
+			BufferWriter writer {segmented};
+
+			writer.section(BufferSegment::R, "constants");
+			writer.label("l_value").put_dword(i * 3);
+
+			writer.section(BufferSegment::R | BufferSegment::X, "code");
+			writer.label("l_main");
+			writer.put_mov(EAX, ref("l_value"));
+			writer.put_ret();
+
+			blocks.push_back(cache.append(segmented));
+		}
+
+		// appending must not move or break the older blocks
+		for (int i = 0; i < 20; i ++) {
+			auto function = reinterpret_cast<int (*)()>(blocks[i].address("l_main"));
+			CHECK(function(), i * 3);
+		}
+
+		CHECK(blocks[0].address(), cache.address());
+		ASSERT(cache.size() <= 20 * 32);
+
+	}
+
+	TEST (writer_exec_code_cache_errors) {
+
+		CodeCache cache {4096};
+
+		SegmentedBuffer data;
+		BufferWriter data_writer {data};
+		data_writer.section(BufferSegment::R | BufferSegment::W);
+		data_writer.put_dword(42);
+
+		EXPECT_THROW(std::runtime_error) {
+			cache.append(data);
+		};
+
+		SegmentedBuffer large;
+		BufferWriter large_writer {large};
+		large_writer.put_space(8000);
+		large_writer.put_ret();
+
+		EXPECT_THROW(std::runtime_error) {
+			cache.append(large);
+		};
+
+		CHECK(cache.size(), 0);
+
+	}
+
+	TEST (writer_exec_code_cache_release) {
+
+		CodeCache cache {4096, 64};
+		std::vector<CodeBlock> blocks;
+
+		auto predicate = [&] (int value) {
+			SegmentedBuffer segmented;
+			BufferWriter writer {segmented};
+
+			writer.put_mov(EAX, value);
+			writer.put_ret();
+
+			return cache.append(segmented);
+		};
+
+		// small functions are packed into the same page
+		for (int i = 0; i < 64; i ++) {
+			blocks.push_back(predicate(i));
+			CHECK(blocks.back().address() - cache.address(), i * 64);
+		}
+
+		EXPECT_THROW(std::runtime_error) {
+			predicate(64);
+		};
+
+		for (int i = 0; i < 64; i += 2) {
+			cache.release(blocks[i]);
+		}
+
+		CodeCacheStats stats = cache.stats();
+		CHECK(stats.used, 32 * 64);
+		CHECK(stats.free, 32 * 64);
+		CHECK(stats.largest, 64);
+		CHECK(stats.ranges, 32);
+		ASSERT(stats.fragmentation() > 0.9);
+
+		EXPECT_THROW(std::runtime_error) {
+			cache.release(blocks[0]);
+		};
+
+		// the freed slots are reused, and the old ones are still there
+		CodeBlock reused = predicate(100);
+		CHECK(reused.address(), blocks[0].address());
+		CHECK(reinterpret_cast<int (*)()>(reused.address())(), 100);
+		CHECK(reinterpret_cast<int (*)()>(blocks[1].address())(), 1);
+
+		cache.release(reused);
+
+		for (int i = 1; i < 64; i += 2) {
+			cache.release(blocks[i]);
+		}
+
+		// all ranges are merged back together
+		stats = cache.stats();
+		CHECK(stats.used, 0);
+		CHECK(stats.ranges, 1);
+		CHECK(stats.largest, 4096);
+		CHECK(stats.fragmentation(), 0);
+
+	}
+
+	TEST (writer_exec_patch_branch) {
+
+		SegmentedBuffer segmented;
+		BufferWriter writer {segmented};
+
+		// the displacement of the patched jump needs to be naturally aligned or fit into an aligned qword
+		writer.label("l_main");
+		writer.put_nop();
+		writer.put_nop();
+		writer.put_nop();
+		writer.label("l_site");
+		writer.put_jmp("l_first");
+
+		writer.label("l_first");
+		writer.put_mov(EAX, 1);
+		writer.put_ret();
+
+		writer.label("l_second");
+		writer.put_mov(EAX, 2);
+		writer.put_ret();
+
+		// this displacement would cross an 8 byte boundary
+		writer.put_nop();
+		writer.label("l_unaligned");
+		writer.put_jmp("l_first");
+
+		ExecutableBuffer buffer = to_executable(segmented);
+		CHECK(buffer.call_i32("l_main"), 1);
+
+		buffer.patch("l_site", buffer.address("l_second"));
+		CHECK(buffer.call_i32("l_main"), 2);
+
+		buffer.patch("l_site", buffer.address("l_first"));
+		CHECK(buffer.call_i32("l_main"), 1);
+
+		EXPECT_THROW(std::runtime_error) {
+			buffer.patch("l_unaligned", buffer.address("l_second"));
+		};
+
+		EXPECT_THROW(std::runtime_error) {
+			buffer.patch("l_first", buffer.address("l_second"));
+		};
+
+	}
+
+	TEST (writer_exec_patch_branch_protection) {
+
+		SegmentedBuffer segmented;
+		BufferWriter writer {segmented};
+
+		// aligned sites are always patchable
+		writer.section(BufferSegment::R | BufferSegment::X, ".aligned");
+		writer.label("l_other");
+		writer.put_nop();
+		writer.align(8);
+		writer.label("l_aligned");
+		writer.put_jmp("l_first");
+
+		writer.section(BufferSegment::R | BufferSegment::X);
+		writer.label("l_first");
+		writer.put_mov(EAX, 1);
+		writer.put_ret();
+
+		writer.label("l_second");
+		writer.put_mov(EAX, 2);
+		writer.put_ret();
+
+		// the site ends the last page, so the patched range reaches into the spare capacity after it
+		writer.label("l_main");
+		writer.put_space(getpagesize() - 12 - 5, 0x90);
+		writer.label("l_site");
+		writer.put_jmp("l_first");
+
+		ExecutableBuffer buffer = to_executable(segmented, getpagesize());
+		CHECK(buffer.call_i32("l_main"), 1);
+
+		buffer.patch("l_site", buffer.address("l_second"));
+		CHECK(buffer.call_i32("l_main"), 2);
+
+		CHECK(get_protection(buffer.address("l_main")), "r-xp");
+		CHECK(get_protection(buffer.address() + buffer.size()), "-w-p");
+
+		buffer.patch("l_aligned", buffer.address("l_second"));
+		CHECK(buffer.call_i32("l_other"), 2);
+
+		// a failed patch still restores the protection
+		EXPECT_THROW(std::runtime_error) {
+			buffer.patch("l_first", buffer.address("l_second"));
+		};
+
+		CHECK(get_protection(buffer.address("l_first")), "r-xp");
+
+	}
+
+	TEST (writer_exec_code_cache_align) {
+
+		CodeCache cache {4096};
+
+		SegmentedBuffer first;
+		BufferWriter {first}.put_ret();
+		cache.append(first);
+
+		// the block needs to be moved past the next free 16 byte slot for the label to stay aligned in memory
+		SegmentedBuffer segmented;
+		BufferWriter writer {segmented};
+
+		writer.put_mov(EAX, 5);
+		writer.align(64);
+		writer.label("l_head");
+		writer.put_ret();
+
+		CodeBlock block = cache.append(segmented);
+
+		CHECK(block.address() - cache.address(), 64);
+		CHECK(reinterpret_cast<size_t>(block.address("l_head")) % 64, 0);
+		CHECK(reinterpret_cast<int (*)()>(block.address())(), 5);
+
+		// the skipped space stays free
+		CodeCacheStats stats = cache.stats();
+		CHECK(stats.used, 16 + 128);
+		CHECK(stats.ranges, 2);
+
+		SegmentedBuffer huge;
+		BufferWriter {huge}.align(getpagesize() * 2);
+
+		EXPECT_THROW(std::runtime_error) {
+			cache.append(huge);
+		};
+
+	}
+
+	TEST (writer_exec_code_cache_rejit) {
+
+		CodeCache cache {4096};
+
+		// every block reuses the slot of the previous one
+		for (int i = 0; i < 200; i ++) {
+			SegmentedBuffer segmented;
+			BufferWriter writer {segmented};
+
+			writer.put_jmp("l_skip");
+			writer.put_mov(EAX, 0);
+			writer.put_ret();
+			writer.label("l_skip");
+			writer.put_mov(EAX, i);
+			writer.put_ret();
+
+			CodeBlock block = cache.append(segmented);
+			CHECK(block.address(), cache.address());
+			CHECK(reinterpret_cast<int (*)()>(block.address())(), i);
+
+			cache.release(block);
+		}
+
+	}
+
+	TEST (writer_exec_code_cache_patch) {
+
+		CodeCache cache {4096};
+
+		SegmentedBuffer segmented;
+		BufferWriter writer {segmented};
+
+		writer.label("l_main");
+		writer.put_test(EDI, EDI);
+		writer.label("l_site");
+		writer.put_je("l_first");
+		writer.put_mov(EAX, 3);
+		writer.put_ret();
+
+		writer.label("l_first");
+		writer.put_mov(EAX, 1);
+		writer.put_ret();
+
+		writer.label("l_second");
+		writer.put_mov(EAX, 2);
+		writer.put_ret();
+
+		CodeBlock block = cache.append(segmented);
+		auto function = reinterpret_cast<int (*)(int)>(block.address("l_main"));
+
+		CHECK(function(0), 1);
+		CHECK(function(1), 3);
+
+		// keep calling the function from a second thread while it is patched
+		std::atomic<bool> done = false;
+		std::atomic<int> invalid = 0;
+
+		std::thread caller {[&] () {
+			while (!done) {
+				const int result = function(0);
+				if (result != 1 && result != 2) invalid ++;
+			}
+		}};
+
+		for (int i = 0; i < 10000; i ++) {
+			cache.patch(block.address("l_site"), block.address(i % 2 ? "l_first" : "l_second"));
+		}
+
+		done = true;
+		caller.join();
+
+		CHECK(invalid.load(), 0);
+		CHECK(function(0), 1);
+
+	}
+
+	TEST (writer_exec_huge_pages) {
+
+		SegmentedBuffer segmented;
+		BufferWriter writer {segmented};
+
+		writer.section(BufferSegment::R, "constants");
+		writer.label("l_value").put_dword(1234);
+
+		writer.section(BufferSegment::R | BufferSegment::X, "code");
+		writer.label("l_main");
+		writer.put_mov(EAX, ref("l_value"));
+		writer.put_ret();
+
+		ExecutableBuffer buffer = to_executable(segmented, 0, true);
+
+		CHECK(reinterpret_cast<size_t>(buffer.address()) % (2 * 1024 * 1024), 0);
+		CHECK(buffer.capacity(), 2 * 2 * 1024 * 1024);
+		CHECK(buffer.call_i32("l_main"), 1234);
+
+	}
+
+	TEST (writer_exec_native_function) {
+
+		SegmentedBuffer segmented;
+		BufferWriter writer {segmented};
+
+		writer.label("l_add");
+		writer.put_lea(RAX, RDI + RSI);
+		writer.put_ret();
+
+		writer.label("l_sum");
+		writer.put_mov(RAX, RDI);
+		writer.put_add(RAX, RSI);
+		writer.put_add(RAX, RDX);
+		writer.put_add(RAX, RCX);
+		writer.put_add(RAX, R8);
+		writer.put_add(RAX, R9);
+		writer.put_ret();
+
+		writer.label("l_load");
+		writer.put_mov(EAX, ref(RDI));
+		writer.put_ret();
+
+		// floating point arguments and results are passed in xmm0
+		writer.label("l_identity");
+		writer.put_ret();
+
+		ExecutableBuffer buffer = to_executable(segmented);
+		const int value = 42;
+
+		CHECK(buffer.function<int64_t(int64_t, int64_t)>("l_add")(40, 2), 42);
+		CHECK(buffer.function<int64_t(int64_t, int64_t, int64_t, int64_t, int64_t, int64_t)>("l_sum")(1, 2, 3, 4, 5, 6), 21);
+		CHECK(buffer.function<int(const int*)>("l_load")(&value), 42);
+		CHECK(buffer.function<double(double)>("l_identity")(1.5), 1.5);
+		CHECK(buffer.function<float(int, float)>("l_identity")(7, 2.5f), 2.5f);
+
+		static_assert(native_function<void(char, uint64_t, float*)>);
+		static_assert(!native_function<int(std::string)>);
+		static_assert(!native_function<long double(long double)>);
+
+	}
+
+	TEST (writer_exec_append) {
+
+		SegmentedBuffer first;
+		BufferWriter first_writer {first};
+
+		first_writer.label("l_double");
+		first_writer.put_lea(EAX, EDI + EDI);
+		first_writer.put_ret();
+
+		ExecutableBuffer buffer = to_executable(first, 2 * getpagesize());
+		CHECK(buffer.size(), getpagesize());
+		CHECK(buffer.capacity(), 3 * getpagesize());
+
+		// calls into the code that is already baked
+		SegmentedBuffer second;
+		second.set_relaxation(true);
+		BufferWriter second_writer {second};
+
+		second_writer.label("l_quadruple");
+		second_writer.put_call("l_double");
+		second_writer.put_mov(EDI, EAX);
+		second_writer.put_jmp("l_double");
+
+		buffer.append(second);
+		CHECK(buffer.call_i32("l_double"), 0);
+
+		// links against labels from both previous buffers
+		SegmentedBuffer third;
+		BufferWriter third_writer {third};
+
+		third_writer.label("l_octuple");
+		third_writer.put_push(RBX);
+		third_writer.put_call("l_quadruple");
+		third_writer.put_mov(EDI, EAX);
+		third_writer.put_call("l_double");
+		third_writer.put_pop(RBX);
+		third_writer.put_ret();
+
+		buffer.append(third);
+		CHECK(buffer.size(), 3 * getpagesize());
+
+		auto quadruple = reinterpret_cast<int (*)(int)>(buffer.address("l_quadruple"));
+		auto octuple = reinterpret_cast<int (*)(int)>(buffer.address("l_octuple"));
+
+		CHECK(quadruple(3), 12);
+		CHECK(octuple(5), 40);
+
+		// no spare capacity left
+		SegmentedBuffer fourth;
+		BufferWriter fourth_writer {fourth};
+		fourth_writer.put_ret();
+
+		EXPECT_THROW(std::runtime_error) {
+			buffer.append(fourth);
+		};
+
+	}
+
+	TEST (writer_exec_imul_short) {
+
+		SegmentedBuffer segmented;
+		BufferWriter writer {segmented};
+
+		writer.put_mov(EAX, -3);
+		writer.put_mov(EDX, 4);
+		writer.put_imul(EAX, EDX);
+		writer.put_ret();
+
+		CHECK(to_executable(segmented).call_u32(), -12);
+
+	}
+
+	TEST (writer_exec_memory_xchg) {
+
+		SegmentedBuffer segmented;
+		BufferWriter writer {segmented};
+
+		writer.label("foo").put_dword(123);
+		writer.label("bar").put_byte(100);
+
+		writer.label("main");
+		writer.put_push(RBX);
+		writer.put_mov(EAX, 33);
+		writer.put_mov(BL, 99);
+		writer.put_xchg(EAX, ref("foo"));
+		writer.put_xchg(ref("bar"), BL);
+		writer.put_pop(RBX);
+		writer.put_ret();
+
+		writer.label("get_foo");
+		writer.put_mov(EAX, ref("foo"));
+		writer.put_ret();
+
+		writer.label("get_bar");
+		writer.put_xor(EAX, EAX);
+		writer.put_mov(AL, ref("bar"));
+		writer.put_ret();
+
+		ExecutableBuffer buffer = to_executable(segmented);
+
+		CHECK(buffer.call_i32("main"), 123);
+		CHECK(buffer.call_i32("get_foo"), 33);
+		CHECK(buffer.call_i32("get_bar"), 99);
+
+	}
+
+	TEST (writer_exec_memory_push_pop) {
+
+		SegmentedBuffer segmented;
+		BufferWriter writer {segmented};
+
+		writer.label("foo").put_dword(123);
+		writer.label("bar").put_word(100);
+		writer.label("car").put_dword(0);
+
+		// just to align the disassembly
+		writer.put_byte(0);
+
+		writer.label("main");
+		writer.put_push(RBX);
+		writer.put_xor(RBX, RBX);
+		writer.put_mov(RAX, 0);
+		writer.put_push(666);
+		writer.put_mov(RSI, "foo");
+		writer.put_push(ref<QWORD>(RAX + RSI));
+		writer.put_mov(RSI, "bar");
+		writer.put_push(ref<WORD>(RAX + RSI));
+		writer.put_pop(BX);
+		writer.put_pop(RAX);
+		writer.put_mov(RSI, "car");
+		writer.put_pop(ref<QWORD>(RSI));
+		writer.put_add(RAX, RBX);
+		writer.put_pop(RBX);
+		writer.put_ret();
+
+		writer.label("get_car");
+		writer.put_xor(RAX, RAX);
+		writer.put_mov(RSI, "car");
+		writer.put_mov(RAX, ref(RSI));
+		writer.put_ret();
+
+		ExecutableBuffer buffer = to_executable(segmented);
+
+		CHECK(buffer.call_i32("main"), 223);
+		CHECK(buffer.call_i32("get_car"), 666);
+
+	}
+
+	TEST (writer_exec_memory_dec_inc) {
+
+		SegmentedBuffer segmented;
+		BufferWriter writer {segmented};
+
+		writer.label("ad").put_dword(150);
+		writer.label("bd").put_word(100);
+		writer.label("cd").put_byte(50);
+		writer.label("ai").put_dword(150);
+		writer.label("bi").put_word(100);
+		writer.label("ci").put_byte(50);
+
+		writer.label("main");
+		writer.put_dec(ref<DWORD>("ad"));
+		writer.put_dec(ref<WORD>("bd"));
+		writer.put_dec(ref<BYTE>("cd"));
+		writer.put_inc(ref<DWORD>("ai"));
+		writer.put_inc(ref<WORD>("bi"));
+		writer.put_inc(ref<BYTE>("ci"));
+		writer.put_cmp(ref<DWORD>("ad"), 149);
+		writer.put_jne("invalid");
+		writer.put_cmp(ref<WORD>("bd"), 99);
+		writer.put_jne("invalid");
+		writer.put_cmp(ref<BYTE>("cd"), 49);
+		writer.put_jne("invalid");
+		writer.put_cmp(ref<DWORD>("ai"), 151);
+		writer.put_jne("invalid");
+		writer.put_cmp(ref<WORD>("bi"), 101);
+		writer.put_jne("invalid");
+		writer.put_cmp(ref<BYTE>("ci"), 51);
+		writer.put_jne("invalid");
+		writer.put_mov(EAX, 1);
+		writer.put_ret();
+
+		writer.label("invalid");
+		writer.put_mov(EAX, 0);
+		writer.put_ret();
+
+		ExecutableBuffer buffer = to_executable(segmented);
+
+		CHECK(buffer.call_i32("main"), 1);
+
+	}
+
+	TEST (writer_exec_memory_neg) {
+
+		SegmentedBuffer segmented;
+		BufferWriter writer {segmented};
+
+		writer.label("a").put_dword(150);
+		writer.label("b").put_word(-100);
+		writer.label("c").put_byte(50);
+
+		writer.label("main");
+		writer.put_neg(ref<DWORD>("a"));
+		writer.put_neg(ref<WORD>("b"));
+		writer.put_neg(ref<BYTE>("c"));
+		writer.put_cmp(ref<DWORD>("a"), -150);
+		writer.put_jne("invalid");
+		writer.put_cmp(ref<WORD>("b"), 100);
+		writer.put_jne("invalid");
+		writer.put_cmp(ref<BYTE>("c"), -50);
+		writer.put_jne("invalid");
+		writer.put_mov(EAX, 1);
+		writer.put_ret();
+
+		writer.label("invalid");
+		writer.put_mov(EAX, 0);
+		writer.put_ret();
+
+		ExecutableBuffer buffer = to_executable(segmented);
+
+		CHECK(buffer.call_i32("main"), 1);
 
 	}
 
@@ -3234,6 +4121,531 @@ namespace test {
 
 	}
 
+	TEST (writer_check_sse_disassembly) {
+
+		SegmentedBuffer segmented;
+		BufferWriter writer {segmented};
+
+		writer.put_movdqa(XMM0, ref(RAX));
+		writer.put_movups(ref(R13 + 16), XMM9);
+		writer.put_pshufb(XMM8, XMM1);
+		writer.put_pcmpeqq(XMM2, ref(RAX + RCX * 4));
+		writer.put_pmovmskb(R10, XMM9);
+		writer.put_movq(XMM12, XMM3);
+		writer.put_cvttsd2si(RAX, XMM1);
+		writer.put_pextrq(ref(RDI), XMM1, 1);
+		writer.put_psrlq(XMM11, 4);
+
+		util::TempFile file {".bin"};
+		const auto& bytes = segmented.segments()[0].buffer;
+		file.write(std::string {bytes.begin(), bytes.end()});
+
+		std::string result = call_shell("objdump -D -b binary -m i386:x86-64 -M intel --no-show-raw-insn " + file.path());
+
+		ASSERT(result.contains("movdqa xmm0,XMMWORD PTR [rax]\n"));
+		ASSERT(result.contains("movups XMMWORD PTR [r13+0x10],xmm9\n"));
+		ASSERT(result.contains("pshufb xmm8,xmm1\n"));
+		ASSERT(result.contains("pcmpeqq xmm2,XMMWORD PTR [rax+rcx*4]\n"));
+		ASSERT(result.contains("pmovmskb r10,xmm9\n"));
+		ASSERT(result.contains("movq   xmm12,xmm3\n"));
+		ASSERT(result.contains("cvttsd2si rax,xmm1\n"));
+		ASSERT(result.contains("pextrq QWORD PTR [rdi],xmm1,0x1\n"));
+		ASSERT(result.contains("psrlq  xmm11,0x4\n"));
+
+	}
+
+	TEST (writer_exec_sse_scalar) {
+
+		SegmentedBuffer segmented;
+		BufferWriter writer {segmented};
+
+		// (a + b) * a / b
+		writer.label("expr");
+		writer.put_movsd(XMM2, XMM0);
+		writer.put_addsd(XMM2, XMM1);
+		writer.put_mulsd(XMM2, XMM0);
+		writer.put_divsd(XMM2, XMM1);
+		writer.put_movapd(XMM0, XMM2);
+		writer.put_ret();
+
+		writer.label("hypot");
+		writer.put_mulss(XMM0, XMM0);
+		writer.put_mulss(XMM1, XMM1);
+		writer.put_addss(XMM0, XMM1);
+		writer.put_sqrtss(XMM0, XMM0);
+		writer.put_ret();
+
+		writer.label("round_trip");
+		writer.put_cvtsi2sd(XMM0, RDI);
+		writer.put_addsd(XMM0, ref("half"));
+		writer.put_cvttsd2si(RAX, XMM0);
+		writer.put_ret();
+
+		writer.label("greater");
+		writer.put_xor(EAX, EAX);
+		writer.put_ucomisd(XMM0, XMM1);
+		writer.put_seta(AL);
+		writer.put_ret();
+
+		writer.label("half");
+		writer.put_qword(std::bit_cast<uint64_t>(0.5));
+
+		ExecutableBuffer buffer = to_executable(segmented);
+		CHECK(buffer.function<double(double, double)>("expr")(3, 2), 7.5);
+		CHECK(buffer.function<float(float, float)>("hypot")(3, 4), 5.0f);
+		CHECK(buffer.function<int64_t(int64_t)>("round_trip")(-7), -6);
+		CHECK(buffer.function<int(double, double)>("greater")(2.5, 1.0), 1);
+		CHECK(buffer.function<int(double, double)>("greater")(1.0, 2.5), 0);
+
+	}
+
+	TEST (writer_exec_sse_packed) {
+
+		SegmentedBuffer segmented;
+		BufferWriter writer {segmented};
+
+		// out[i] = max(a[i] * b[i], a[i] + b[i]) for four signed integers
+		writer.label("mul_add_max");
+		writer.put_movdqu(XMM0, ref(RDI));
+		writer.put_movdqu(XMM1, ref(RSI));
+		writer.put_movdqa(XMM2, XMM0);
+		writer.put_pmulld(XMM0, XMM1);
+		writer.put_paddd(XMM1, XMM2);
+		writer.put_pmaxsd(XMM0, XMM1);
+		writer.put_movdqu(ref(RDX), XMM0);
+		writer.put_ret();
+
+		// reverse the order of four floats and scale them by two
+		writer.label("reverse_double");
+		writer.put_movups(XMM8, ref(RDI));
+		writer.put_shufps(XMM8, XMM8, 0b00011011);
+		writer.put_addps(XMM8, XMM8);
+		writer.put_movups(ref(RDI), XMM8);
+		writer.put_ret();
+
+		// swap the bytes of each doubleword, using a mask stored in a separate segment
+		writer.label("bswap");
+		writer.put_movdqu(XMM0, ref(RDI));
+		writer.put_pshufb(XMM0, ref("bswap_mask"));
+		writer.put_pextrd(EAX, XMM0, 2);
+		writer.put_movdqu(ref(RDI), XMM0);
+		writer.put_ret();
+
+		// pshufd with a RIP-relative operand followed by the immediate
+		writer.label("broadcast");
+		writer.put_pshufd(XMM0, ref("bswap_mask"), 0);
+		writer.put_movd(EAX, XMM0);
+		writer.put_ret();
+
+		// legacy SSE memory operands need to be 16 byte aligned, segments start on a page boundary
+		writer.section(BufferSegment::R);
+		writer.label("bswap_mask");
+		writer.put_dword(0x00010203);
+		writer.put_dword(0x04050607);
+		writer.put_dword(0x08090A0B);
+		writer.put_dword(0x0C0D0E0F);
+
+		ExecutableBuffer buffer = to_executable(segmented);
+
+		int32_t a[4] = {1, -2, 3, 10};
+		int32_t b[4] = {5, -3, 1, 0};
+		int32_t out[4] = {};
+		buffer.function<void(int32_t*, int32_t*, int32_t*)>("mul_add_max")(a, b, out);
+
+		CHECK(out[0], 6);
+		CHECK(out[1], 6);
+		CHECK(out[2], 4);
+		CHECK(out[3], 10);
+
+		float floats[4] = {1.0f, 2.5f, -3.0f, 4.0f};
+		buffer.function<void(float*)>("reverse_double")(floats);
+
+		CHECK(floats[0], 8.0f);
+		CHECK(floats[1], -6.0f);
+		CHECK(floats[2], 5.0f);
+		CHECK(floats[3], 2.0f);
+
+		uint32_t words[4] = {0x11223344, 0x55667788, 0x99AABBCC, 0xDDEEFF00};
+		CHECK(buffer.function<uint32_t(uint32_t*)>("bswap")(words), 0xCCBBAA99);
+
+		CHECK(words[0], 0x44332211);
+		CHECK(words[1], 0x88776655);
+		CHECK(words[3], 0x00FFEEDD);
+
+		CHECK(buffer.function<uint32_t()>("broadcast")(), 0x00010203);
+
+	}
+
+	TEST (writer_exec_sse_strlen) {
+
+		SegmentedBuffer segmented;
+		BufferWriter writer {segmented};
+
+		// compare 16 bytes at a time, the buffer is padded so reading past the terminator is safe
+		writer.label("strlen");
+		writer.put_mov(RAX, RDI);
+		writer.put_pxor(XMM0, XMM0);
+		writer.label("loop");
+		writer.put_movdqu(XMM1, ref(RAX));
+		writer.put_pcmpeqb(XMM1, XMM0);
+		writer.put_pmovmskb(ECX, XMM1);
+		writer.put_test(ECX, ECX);
+		writer.put_jnz("found");
+		writer.put_add(RAX, 16);
+		writer.put_jmp("loop");
+		writer.label("found");
+		writer.put_bsf(ECX, ECX);
+		writer.put_add(RAX, RCX);
+		writer.put_sub(RAX, RDI);
+		writer.put_ret();
+
+		ExecutableBuffer buffer = to_executable(segmented);
+		auto strlen = buffer.function<uint64_t(const char*)>("strlen");
+
+		char text[64] = {};
+		CHECK(strlen(text), 0);
+
+		strcpy(text, "Hello!");
+		CHECK(strlen(text), 6);
+
+		strcpy(text, "The quick brown fox jumps over the lazy dog");
+		CHECK(strlen(text), 43);
+
+	}
+
+	TEST (writer_check_avx_disassembly) {
+
+		SegmentedBuffer segmented;
+		BufferWriter writer {segmented};
+
+		writer.put_vmovdqu(ref(R13 + 32), YMM9);
+		writer.put_vaddpd(YMM8, YMM9, ref(RSI));
+		writer.put_vaddsd(XMM0, XMM14, ref(RSP + 8));
+		writer.put_vfmadd213ps(YMM0, YMM1, YMM12);
+		writer.put_vfnmsub231sd(XMM0, XMM1, XMM2);
+		writer.put_vpermd(YMM0, YMM1, YMM2);
+		writer.put_vpslld(YMM0, YMM11, 3);
+		writer.put_vpbroadcastd(YMM0, ref<DWORD>(RDI));
+		writer.put_vextracti128(XMM0, YMM1, 1);
+		writer.put_vpgatherqq(YMM0, ref(R12 + YMM9 * 8 + 16), YMM2);
+		writer.put_vpmovmskb(EAX, YMM1);
+		writer.put_vzeroupper();
+
+		util::TempFile file {".bin"};
+		const auto& bytes = segmented.segments()[0].buffer;
+		file.write(std::string {bytes.begin(), bytes.end()});
+
+		std::string result = call_shell("objdump -D -b binary -m i386:x86-64 -M intel --no-show-raw-insn " + file.path());
+
+		ASSERT(result.contains("vmovdqu YMMWORD PTR [r13+0x20],ymm9\n"));
+		ASSERT(result.contains("vaddpd ymm8,ymm9,YMMWORD PTR [rsi]\n"));
+		ASSERT(result.contains("vaddsd xmm0,xmm14,QWORD PTR [rsp+0x8]\n"));
+		ASSERT(result.contains("vfmadd213ps ymm0,ymm1,ymm12\n"));
+		ASSERT(result.contains("vfnmsub231sd xmm0,xmm1,xmm2\n"));
+		ASSERT(result.contains("vpermd ymm0,ymm1,ymm2\n"));
+		ASSERT(result.contains("vpslld ymm0,ymm11,0x3\n"));
+		ASSERT(result.contains("vpbroadcastd ymm0,DWORD PTR [rdi]\n"));
+		ASSERT(result.contains("vextracti128 xmm0,ymm1,0x1\n"));
+		ASSERT(result.contains("vpgatherqq ymm0,QWORD PTR [r12+ymm9*8+0x10],ymm2\n"));
+		ASSERT(result.contains("vpmovmskb eax,ymm1\n"));
+		ASSERT(result.contains("vzeroupper\n"));
+
+	}
+
+	TEST (writer_exec_avx_kernels) {
+
+		if (!__builtin_cpu_supports("avx2") || !__builtin_cpu_supports("fma")) {
+			SKIP("AVX2 and FMA not supported");
+		}
+
+		SegmentedBuffer segmented;
+		BufferWriter writer {segmented};
+
+		// out[i] = a[i] * b[i] + out[i] for eight floats
+		writer.label("fma");
+		writer.put_vmovups(YMM0, ref(RDI));
+		writer.put_vmovups(YMM1, ref(RDX));
+		writer.put_vfmadd231ps(YMM1, YMM0, ref(RSI));
+		writer.put_vmovups(ref(RDX), YMM1);
+		writer.put_vzeroupper();
+		writer.put_ret();
+
+		// mask of the integers greater than the threshold, eight at a time
+		writer.label("mask_greater");
+		writer.put_vmovd(XMM1, ESI);
+		writer.put_vpbroadcastd(YMM1, XMM1);
+		writer.put_vmovdqu(YMM0, ref(RDI));
+		writer.put_vpcmpgtd(YMM0, YMM0, YMM1);
+		writer.put_vmovmskps(EAX, YMM0);
+		writer.put_vzeroupper();
+		writer.put_ret();
+
+		// out[i] = table[index[i]], reversing the order of the elements using vpermd
+		writer.label("gather_reverse");
+		writer.put_vmovdqu(YMM1, ref(RSI));
+		writer.put_vpcmpeqd(YMM2, YMM2, YMM2);
+		writer.put_vpxor(YMM0, YMM0, YMM0);
+		writer.put_vpgatherdd(YMM0, ref(RDI + YMM1 * 4), YMM2);
+		writer.put_vmovdqu(YMM3, ref("reverse"));
+		writer.put_vpermd(YMM0, YMM3, YMM0);
+		writer.put_vmovdqu(ref(RDX), YMM0);
+		writer.put_vzeroupper();
+		writer.put_ret();
+
+		writer.section(BufferSegment::R);
+		writer.label("reverse");
+		for (int i = 7; i >= 0; i --) {
+			writer.put_dword(i);
+		}
+
+		ExecutableBuffer buffer = to_executable(segmented);
+
+		float a[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+		float b[8] = {2, 2, 2, 2, -1, -1, -1, -1};
+		float c[8] = {0, 1, 0, 1, 0, 1, 0, 1};
+		buffer.function<void(float*, float*, float*)>("fma")(a, b, c);
+
+		CHECK(c[0], 2.0f);
+		CHECK(c[1], 5.0f);
+		CHECK(c[4], -5.0f);
+		CHECK(c[7], -7.0f);
+
+		int32_t values[8] = {5, -3, 12, 7, 0, 100, 6, 7};
+		CHECK(buffer.function<int(int32_t*, int32_t)>("mask_greater")(values, 6), 0b10101100);
+		CHECK(buffer.function<int(int32_t*, int32_t)>("mask_greater")(values, -10), 0b11111111);
+
+		int32_t table[16] = {0, 10, 20, 30, 40, 50, 60, 70, 80, 90, 100, 110, 120, 130, 140, 150};
+		int32_t index[8] = {15, 0, 3, 3, 8, 1, 2, 9};
+		int32_t out[8] = {};
+		buffer.function<void(int32_t*, int32_t*, int32_t*)>("gather_reverse")(table, index, out);
+
+		CHECK(out[0], 90);
+		CHECK(out[1], 20);
+		CHECK(out[2], 10);
+		CHECK(out[3], 80);
+		CHECK(out[6], 0);
+		CHECK(out[7], 150);
+
+	}
+
+	TEST (writer_check_avx512_disassembly) {
+
+		SegmentedBuffer segmented;
+		BufferWriter writer {segmented};
+
+		writer.put_vaddps(ZMM31, ZMM16, ZMM8);
+		writer.put_vaddpd(maskz(ZMM1, K7), ZMM2, ZMM3);
+		writer.put_vaddps(ZMM1, ZMM2, ref(RAX + 8192));
+		writer.put_vaddps(ZMM1, ZMM2, ref(RAX + 32));
+		writer.put_vfmadd231pd(ZMM20, ZMM21, broadcast(R8));
+		writer.put_vmovups(mask(ref(RDI + 128), K3), ZMM9);
+		writer.put_vpaddq(XMM17, XMM2, XMM3);
+		writer.put_vpaddq(YMM0, YMM1, ref(RAX + 200));
+		writer.put_vpcmpeqd(K1, ZMM2, ZMM3);
+		writer.put_vpternlogd(ZMM1, ZMM2, ZMM3, 0xE8);
+		writer.put_vpcompressd(mask(ref(RDI + 8), K1), ZMM1);
+		writer.put_vpsraq(ZMM1, ZMM2, 7);
+		writer.put_kmovq(R12, K7);
+		writer.put_kxnorw(K1, K2, K3);
+
+		util::TempFile file {".bin"};
+		const auto& bytes = segmented.segments()[0].buffer;
+		file.write(std::string {bytes.begin(), bytes.end()});
+
+		std::string result = call_shell("objdump -D -b binary -m i386:x86-64 -M intel --no-show-raw-insn " + file.path());
+
+		ASSERT(result.contains("vaddps zmm31,zmm16,zmm8\n"));
+		ASSERT(result.contains("vaddpd zmm1{k7}{z},zmm2,zmm3\n"));
+		ASSERT(result.contains("vaddps zmm1,zmm2,ZMMWORD PTR [rax+0x2000]\n"));
+		ASSERT(result.contains("vaddps zmm1,zmm2,ZMMWORD PTR [rax+0x20]\n"));
+		ASSERT(result.contains("vfmadd231pd zmm20,zmm21,QWORD BCST [r8]\n"));
+		ASSERT(result.contains("vmovups ZMMWORD PTR [rdi+0x80]{k3},zmm9\n"));
+		ASSERT(result.contains("vpaddq xmm17,xmm2,xmm3\n"));
+		ASSERT(result.contains("vpaddq ymm0,ymm1,YMMWORD PTR [rax+0xc8]\n"));
+		ASSERT(result.contains("vpcmpeqd k1,zmm2,zmm3\n"));
+		ASSERT(result.contains("vpternlogd zmm1,zmm2,zmm3,0xe8\n"));
+		ASSERT(result.contains("vpcompressd ZMMWORD PTR [rdi+0x8]{k1},zmm1\n"));
+		ASSERT(result.contains("vpsraq zmm1,zmm2,0x7\n"));
+		ASSERT(result.contains("kmovq  r12,k7\n"));
+		ASSERT(result.contains("kxnorw k1,k2,k3\n"));
+
+	}
+
+	TEST (writer_exec_avx512_kernels) {
+
+		if (!__builtin_cpu_supports("avx512f")) {
+			SKIP("AVX-512 not supported");
+		}
+
+		SegmentedBuffer segmented;
+		BufferWriter writer {segmented};
+
+		// out[i] = a[i] * scale for sixteen floats, the negative elements are cleared
+		writer.label("scale_positive");
+		writer.put_vmovups(ZMM0, ref(RDI));
+		writer.put_vpxord(ZMM2, ZMM2, ZMM2);
+		writer.put_vcmpps(K1, ZMM0, ZMM2, 0x0D);
+		writer.put_vmulps(maskz(ZMM0, K1), ZMM0, broadcast(RSI));
+		writer.put_vmovups(ref(RDX), ZMM0);
+		writer.put_vzeroupper();
+		writer.put_ret();
+
+		// copy the integers greater than the threshold, returns the mask of the copied elements
+		writer.label("filter_greater");
+		writer.put_vmovd(XMM1, ESI);
+		writer.put_vpbroadcastd(ZMM1, XMM1);
+		writer.put_vmovdqu32(ZMM0, ref(RDI));
+		writer.put_vpcmpd(K1, ZMM0, ZMM1, 6);
+		writer.put_vpcompressd(mask(ref(RDX), K1), ZMM0);
+		writer.put_kmovw(EAX, K1);
+		writer.put_vzeroupper();
+		writer.put_ret();
+
+		ExecutableBuffer buffer = to_executable(segmented);
+
+		float a[16] = {1, -2, 3, -4, 5, 6, 7, 8, -9, 10, 11, 12, 13, 14, 15, -16};
+		float scale = 0.5f;
+		float c[16] = {};
+		buffer.function<void(float*, float*, float*)>("scale_positive")(a, &scale, c);
+
+		CHECK(c[0], 0.5f);
+		CHECK(c[1], 0.0f);
+		CHECK(c[4], 2.5f);
+		CHECK(c[8], 0.0f);
+		CHECK(c[14], 7.5f);
+		CHECK(c[15], 0.0f);
+
+		int32_t values[16] = {5, -3, 12, 7, 0, 100, 6, 7, 1, 2, 3, 4, 50, 60, 70, 80};
+		int32_t out[16] = {};
+		CHECK(buffer.function<int(int32_t*, int32_t, int32_t*)>("filter_greater")(values, 6, out), 0b1111'0000'1010'1100);
+
+		CHECK(out[0], 12);
+		CHECK(out[1], 7);
+		CHECK(out[2], 100);
+		CHECK(out[3], 7);
+		CHECK(out[4], 50);
+		CHECK(out[7], 80);
+		CHECK(out[8], 0);
+
+	}
+
+	TEST (writer_check_bmi_disassembly) {
+
+		SegmentedBuffer segmented;
+		BufferWriter writer {segmented};
+
+		writer.put_popcnt(R10D, ref(RSP + 8));
+		writer.put_lzcnt(RAX, RCX);
+		writer.put_tzcnt(R15, RBX);
+		writer.put_andn(R8, R9, ref(R10 + 16));
+		writer.put_bextr(EAX, ref(RSI), R11D);
+		writer.put_blsmsk(RAX, RBX);
+		writer.put_pdep(EAX, R14D, ref(RDI));
+		writer.put_shrx(RAX, ref(RBX + 8), R12);
+		writer.put_rorx(R9, ref(RDI), 63);
+		writer.put_mulx(RDX, RAX, RCX);
+		writer.put_adox(ECX, ref(RSP));
+
+		util::TempFile file {".bin"};
+		const auto& bytes = segmented.segments()[0].buffer;
+		file.write(std::string {bytes.begin(), bytes.end()});
+
+		std::string result = call_shell("objdump -D -b binary -m i386:x86-64 -M intel --no-show-raw-insn " + file.path());
+
+		ASSERT(result.contains("popcnt r10d,DWORD PTR [rsp+0x8]\n"));
+		ASSERT(result.contains("lzcnt  rax,rcx\n"));
+		ASSERT(result.contains("tzcnt  r15,rbx\n"));
+		ASSERT(result.contains("andn   r8,r9,QWORD PTR [r10+0x10]\n"));
+		ASSERT(result.contains("bextr  eax,DWORD PTR [rsi],r11d\n"));
+		ASSERT(result.contains("blsmsk rax,rbx\n"));
+		ASSERT(result.contains("pdep   eax,r14d,DWORD PTR [rdi]\n"));
+		ASSERT(result.contains("shrx   rax,QWORD PTR [rbx+0x8],r12\n"));
+		ASSERT(result.contains("rorx   r9,QWORD PTR [rdi],0x3f\n"));
+		ASSERT(result.contains("mulx   rdx,rax,rcx\n"));
+		ASSERT(result.contains("adox   ecx,DWORD PTR [rsp]\n"));
+
+	}
+
+	TEST (writer_exec_bmi_kernels) {
+
+		if (!__builtin_cpu_supports("popcnt") || !__builtin_cpu_supports("lzcnt") || !__builtin_cpu_supports("bmi") || !__builtin_cpu_supports("bmi2") || !__builtin_cpu_supports("adx")) {
+			SKIP("BMI1, BMI2, LZCNT, POPCNT or ADX not supported");
+		}
+
+		SegmentedBuffer segmented;
+		BufferWriter writer {segmented};
+
+		// returns popcnt | lzcnt << 8 | tzcnt << 16
+		writer.label("bit_stats");
+		writer.put_popcnt(RAX, RDI);
+		writer.put_lzcnt(RCX, RDI);
+		writer.put_shl(RCX, 8);
+		writer.put_or(RAX, RCX);
+		writer.put_tzcnt(RCX, RDI);
+		writer.put_shl(RCX, 16);
+		writer.put_or(RAX, RCX);
+		writer.put_ret();
+
+		writer.label("pext");
+		writer.put_pext(RAX, RDI, RSI);
+		writer.put_ret();
+
+		writer.label("pdep");
+		writer.put_pdep(RAX, RDI, RSI);
+		writer.put_ret();
+
+		writer.label("blsr");
+		writer.put_blsr(RAX, RDI);
+		writer.put_ret();
+
+		writer.label("bextr");
+		writer.put_bextr(RAX, RDI, RSI);
+		writer.put_ret();
+
+		writer.label("sarx");
+		writer.put_sarx(RAX, RDI, RSI);
+		writer.put_ret();
+
+		// high half of the unsigned 128 bit product
+		writer.label("mulx");
+		writer.put_mov(RDX, RDI);
+		writer.put_mulx(RAX, RCX, RSI);
+		writer.put_ret();
+
+		// a += b for 128 bit integers, 'xor' clears the carry flag
+		writer.label("add128");
+		writer.put_xor(EAX, EAX);
+		writer.put_mov(RAX, ref(RDI));
+		writer.put_adcx(RAX, ref(RSI));
+		writer.put_mov(ref(RDI), RAX);
+		writer.put_mov(RAX, ref(RDI + 8));
+		writer.put_adcx(RAX, ref(RSI + 8));
+		writer.put_mov(ref(RDI + 8), RAX);
+		writer.put_ret();
+
+		ExecutableBuffer buffer = to_executable(segmented);
+
+		auto bit_stats = buffer.function<uint64_t(uint64_t)>("bit_stats");
+		CHECK(bit_stats(0), 64 << 16 | 64 << 8 | 0);
+		CHECK(bit_stats(0b1011000), 3 << 16 | 57 << 8 | 3);
+		CHECK(bit_stats(UINT64_MAX), 0 << 16 | 0 << 8 | 64);
+
+		CHECK(buffer.function<uint64_t(uint64_t, uint64_t)>("pext")(0xABCD, 0xF0F0), 0xAC);
+		CHECK(buffer.function<uint64_t(uint64_t, uint64_t)>("pdep")(0xAC, 0xF0F0), 0xA0C0);
+		CHECK(buffer.function<uint64_t(uint64_t)>("blsr")(0b101100), 0b101000);
+		CHECK(buffer.function<uint64_t(uint64_t, uint64_t)>("bextr")(0xABCDEF, 8 | 12 << 8), 0xBCD);
+		CHECK(buffer.function<int64_t(int64_t, int64_t)>("sarx")(-256, 68), -16);
+		CHECK(buffer.function<uint64_t(uint64_t, uint64_t)>("mulx")(UINT64_MAX, 6), 5);
+
+		uint64_t a[2] = {UINT64_MAX, 1};
+		uint64_t b[2] = {2, 3};
+		buffer.function<void(uint64_t*, uint64_t*)>("add128")(a, b);
+
+		CHECK(a[0], 1);
+		CHECK(a[1], 5);
+
+	}
+
 	TEST (writer_elf_simple) {
 
 		using namespace asmio;
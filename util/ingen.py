@@ -7,6 +7,66 @@ import os
 # architecture specific Buffer Writers and the TASML assembler in infrastructure,
 # specifically the language module exposed by the language though the registry.
 
+# Mnemonic dispatch uses a two level perfect hash (hash and displace), the first level
+# hash picks a bucket, and the per-bucket seed is then chosen so that all mnemonics in that bucket
+# land in distinct free table slots. Both hashes need to match 'hash_mnemonic' in the generated code.
+
+FNV_BASIS = 0xcbf29ce484222325
+FNV_PRIME = 0x100000001b3
+MASK = 0xFFFFFFFFFFFFFFFF
+
+# Seeds are usually found within a few dozen attempts, running out means the table is too dense
+MAX_SEED_ATTEMPTS = 1 << 16
+
+def hash_tmix64(x):
+	x = ((x ^ (x >> 30)) * 0xbf58476d1ce4e5b9) & MASK
+	x = ((x ^ (x >> 27)) * 0x94d049bb133111eb) & MASK
+	x = x ^ (x >> 31)
+	return 1 if x == 0 else x
+
+def hash_mnemonic(mnemonic, seed):
+	value = FNV_BASIS ^ seed
+
+	for chr in mnemonic.encode():
+		value = ((value ^ chr) * FNV_PRIME) & MASK
+
+	return hash_tmix64(value)
+
+def build_perfect_hash(mnemonics):
+	size = 1
+
+	while size < len(mnemonics) * 1.25:
+		size *= 2
+
+	buckets = [[] for _ in range(max(1, size // 4))]
+
+	for mnemonic in mnemonics:
+		buckets[hash_mnemonic(mnemonic, 0) % len(buckets)].append(mnemonic)
+
+	seeds = [0] * len(buckets)
+	table = [None] * size
+
+	for index in sorted(range(len(buckets)), key=lambda i: -len(buckets[i])):
+		bucket = buckets[index]
+
+		if not bucket:
+			continue
+
+		for seed in range(1, MAX_SEED_ATTEMPTS + 1):
+			slots = [hash_mnemonic(mnemonic, seed) % size for mnemonic in bucket]
+
+			if len({*slots}) == len(slots) and all(table[slot] is None for slot in slots):
+				break
+		else:
+			sys.exit(f'Failed to build the mnemonic hash table, none of the first {MAX_SEED_ATTEMPTS} seeds places {bucket} into free slots')
+
+		for mnemonic, slot in zip(bucket, slots):
+			table[slot] = mnemonic
+
+		seeds[index] = seed
+
+	return seeds, table
+
 for arg in sys.argv[1:]:
 	arch = os.path.basename(os.path.dirname(arg))
 	output = "src/generated/" + arch + ".hpp"
@@ -107,14 +167,18 @@ for arg in sys.argv[1:]:
 		ouf.write(f"// re-generated by CMake when 'src/asm/{arch}/writer.hpp' changes.{pad}//\n")
 		ouf.write(f"// ---------------------------------------------------------------- //\n\n")
 
-		ouf.write(f'static bool try_parse_instruction(TokenStream& statement, BufferWriter& writer) {{\n\n')
+		ouf.write(f'static bool try_parse_instruction(TokenStream& statement, BufferWriter& writer);\n\n')
+
+		# mnemonic to handler function name, instructions take precedence over prefixes
+		handlers = {}
 
 		for mnemonic in instructions:
 
 			argc = 0
 			aidx = 0
 
-			ouf.write(f'\tif (statement.accept("{mnemonic}")) {{\n')
+			handlers[mnemonic] = f'parse_inst_{mnemonic}'
+			ouf.write(f'static bool parse_inst_{mnemonic}(TokenStream& statement, BufferWriter& writer) {{\n')
 			sets = instructions[mnemonic]
 
 			for sdx in range(len(sets)):
@@ -131,8 +195,8 @@ for arg in sys.argv[1:]:
 				ndx = sdx + 1
 				if ndx < len(sets):
 					if count >= len(sets[ndx]):
-						try_prefix = "\t\t\ttry {\n"
-						try_suffix = "\t\t\t} catch (const std::runtime_error& e) {}\n"
+						try_prefix = "\t\ttry {\n"
+						try_suffix = "\t\t} catch (const std::runtime_error& e) {}\n"
 						try_indent = "\t"
 						needs_cleanup = True
 
@@ -143,38 +207,81 @@ for arg in sys.argv[1:]:
 					new_args -= len(sets[sdx - 1])
 
 				for new_arg in range(0, new_args):
-					ouf.write(f'\t\tTokenStream a{aidx} = statement.expression();\n')
+					ouf.write(f'\tTokenStream a{aidx} = statement.expression();\n')
 					aidx += 1
 
 				for i in range(0, count):
 					args.append(f'parse_argument<{set[i]}>(a{i})')
 
-				ouf.write(f'\n\t\tif (statement.empty()) {{\n')
+				ouf.write(f'\n\tif (statement.empty()) {{\n')
 				ouf.write(try_prefix)
-				ouf.write(f'\t\t\t{try_indent}writer.put_{mnemonic}({", ".join(args)});\n')
-				ouf.write(f'\t\t\t{try_indent}return true;\n')
+				ouf.write(f'\t\t{try_indent}writer.put_{mnemonic}({", ".join(args)});\n')
+				ouf.write(f'\t\t{try_indent}return true;\n')
 				ouf.write(try_suffix)
 
 				if needs_cleanup:
 					ouf.write("\n")
 					for arx in range(0, aidx):
-						ouf.write(f"\t\t\ta{arx}.rewind();\n")
+						ouf.write(f"\t\ta{arx}.rewind();\n")
 
-				ouf.write(f'\t\t}}\n')
+				ouf.write(f'\t}}\n')
 
 				if not needs_cleanup:
 					ouf.write("\n")
 
-			ouf.write(f'\t\tthrow std::runtime_error {{"Invalid argument count"}};\n')
-			ouf.write(f'\t}}\n\n')
+			ouf.write(f'\tthrow std::runtime_error {{"Invalid argument count"}};\n')
+			ouf.write(f'}}\n\n')
 
 		for mnemonic in prefixes:
-			ouf.write(f'\tif (statement.accept("{mnemonic}")) {{\n')
-			ouf.write(f'\t\twriter.put_{mnemonic}();\n')
+			if mnemonic in handlers:
+				continue
 
-			ouf.write(f'\t\tTokenStream suffix = statement.statement();\n')
-			ouf.write(f'\t\treturn try_parse_instruction(suffix, writer);\n')
-			ouf.write(f'\t}}\n\n')
+			handlers[mnemonic] = f'parse_prefix_{mnemonic}'
+			ouf.write(f'static bool parse_prefix_{mnemonic}(TokenStream& statement, BufferWriter& writer) {{\n')
+			ouf.write(f'\twriter.put_{mnemonic}();\n')
+
+			ouf.write(f'\tTokenStream suffix = statement.statement();\n')
+			ouf.write(f'\treturn try_parse_instruction(suffix, writer);\n')
+			ouf.write(f'}}\n\n')
+
+		seeds, table = build_perfect_hash(list(handlers))
+
+		ouf.write(f'struct MnemonicEntry {{\n')
+		ouf.write(f'\tstd::string_view mnemonic;\n')
+		ouf.write(f'\tbool (*handler) (TokenStream& statement, BufferWriter& writer);\n')
+		ouf.write(f'}};\n\n')
+
+		ouf.write(f'static constexpr uint64_t hash_mnemonic(std::string_view mnemonic, uint64_t seed) {{\n')
+		ouf.write(f'\tuint64_t hash = {FNV_BASIS:#x} ^ seed;\n\n')
+		ouf.write(f'\tfor (char chr : mnemonic) {{\n')
+		ouf.write(f'\t\thash = (hash ^ (uint8_t) chr) * {FNV_PRIME:#x};\n')
+		ouf.write(f'\t}}\n\n')
+		ouf.write(f'\treturn util::hash_tmix64(hash);\n')
+		ouf.write(f'}}\n\n')
+
+		ouf.write(f'static constexpr uint32_t mnemonic_seeds[{len(seeds)}] {{\n')
+		for i in range(0, len(seeds), 16):
+			ouf.write('\t' + ', '.join(str(seed) for seed in seeds[i:i + 16]) + ',\n')
+		ouf.write(f'}};\n\n')
+
+		ouf.write(f'static constexpr MnemonicEntry mnemonic_table[{len(table)}] {{\n')
+		for mnemonic in table:
+			if mnemonic is None:
+				ouf.write(f'\t{{"", nullptr}},\n')
+			else:
+				ouf.write(f'\t{{"{mnemonic}", {handlers[mnemonic]}}},\n')
+		ouf.write(f'}};\n\n')
 
-		ouf.write(f'\treturn false;\n')
-		ouf.write(f'}}\n')
\ No newline at end of file
+		ouf.write(f'static bool try_parse_instruction(TokenStream& statement, BufferWriter& writer) {{\n\n')
+		ouf.write(f'\tif (statement.empty()) {{\n')
+		ouf.write(f'\t\treturn false;\n')
+		ouf.write(f'\t}}\n\n')
+		ouf.write(f'\tconst std::string_view mnemonic = statement.peek().raw;\n')
+		ouf.write(f'\tconst uint32_t seed = mnemonic_seeds[hash_mnemonic(mnemonic, 0) % {len(seeds)}];\n')
+		ouf.write(f'\tconst MnemonicEntry& entry = mnemonic_table[hash_mnemonic(mnemonic, seed) % {len(table)}];\n\n')
+		ouf.write(f'\tif (entry.mnemonic != mnemonic) {{\n')
+		ouf.write(f'\t\treturn false;\n')
+		ouf.write(f'\t}}\n\n')
+		ouf.write(f'\tstatement.next();\n')
+		ouf.write(f'\treturn entry.handler(statement, writer);\n')
+		ouf.write(f'}}\n')